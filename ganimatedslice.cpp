@@ -0,0 +1,206 @@
+/**
+ * @file ganimatedslice.cpp
+ * @brief Source file for animating a 2D slice of 3D Perlin noise along z with cached lattice planes
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GANIMATEDSLICE_CPP_INCLUDED
+#define GANIMATEDSLICE_CPP_INCLUDED
+
+#include "ganimatedslice.h"
+
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename Real>
+AnimatedSlice<Real>::AnimatedSlice()
+{
+    m_iLowerLevel = 0;
+    m_bPlanesValid = false;
+    m_ullPlaneBuilds = 0;
+    m_udtGradientSet = Gradient_Set_Classic;
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename Real>
+AnimatedSlice<Real>::~AnimatedSlice()
+{
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Caches one z lattice plane for every sample. \n
+* The gradient dot product is linear, so for a corner on the plane it splits into an x, y part that
+* never changes and a z slope. Both are interpolated across x and y once here, leaving a line in z.
+*/
+template<typename Real>
+void AnimatedSlice<Real>::BuildPlane(int level, int plane)
+{
+    const size_t count = m_vFractionX.size();
+    const int newZ = level & 0xff;
+    const Real one = Real(1);
+    const Real zero = Real(0);
+    Real* values = &m_vPlaneValues[plane][0];
+    Real* slopes = &m_vPlaneSlopes[plane][0];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int* corners = &m_vCornerHashes[i * 4];
+        const Real x = m_vFractionX[i];
+        const Real y = m_vFractionY[i];
+
+        int h00 = PermutationTable[(corners[0] + newZ) & 0xff];
+        int h10 = PermutationTable[(corners[1] + newZ) & 0xff];
+        int h01 = PermutationTable[(corners[2] + newZ) & 0xff];
+        int h11 = PermutationTable[(corners[3] + newZ) & 0xff];
+
+        values[i] = LerpReal(LerpReal(RealGradient3D(h00, x, y, zero, m_udtGradientSet), RealGradient3D(h10, x - one, y, zero, m_udtGradientSet), m_vFadeX[i]),
+            LerpReal(RealGradient3D(h01, x, y - one, zero, m_udtGradientSet), RealGradient3D(h11, x - one, y - one, zero, m_udtGradientSet), m_vFadeX[i]), m_vFadeY[i]);
+        slopes[i] = LerpReal(LerpReal(RealGradient3D(h00, zero, zero, one, m_udtGradientSet), RealGradient3D(h10, zero, zero, one, m_udtGradientSet), m_vFadeX[i]),
+            LerpReal(RealGradient3D(h01, zero, zero, one, m_udtGradientSet), RealGradient3D(h11, zero, zero, one, m_udtGradientSet), m_vFadeX[i]), m_vFadeY[i]);
+    }
+
+    m_ullPlaneBuilds++;
+}
+
+
+
+/**
+* \brief Sets the x, y points every frame is evaluated at and drops the cached planes
+*/
+template<typename Real>
+void AnimatedSlice<Real>::SetPoints(const Real* x, const Real* y, size_t count)
+{
+    m_vFractionX.resize(count);
+    m_vFractionY.resize(count);
+    m_vFadeX.resize(count);
+    m_vFadeY.resize(count);
+    m_vCornerHashes.resize(count * 4);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int cellX = RealFloorToInt(x[i]);
+        const int cellY = RealFloorToInt(y[i]);
+        const int newX = cellX & 0xff;
+        const int newY = cellY & 0xff;
+
+        m_vFractionX[i] = x[i] - Real(cellX);
+        m_vFractionY[i] = y[i] - Real(cellY);
+        m_vFadeX[i] = FadeReal(m_vFractionX[i]);
+        m_vFadeY[i] = FadeReal(m_vFractionY[i]);
+
+        int A = (PermutationTable[newX] + newY) & 0xff;
+        int B = (PermutationTable[newX + 1] + newY) & 0xff;
+        m_vCornerHashes[i * 4] = PermutationTable[A];
+        m_vCornerHashes[i * 4 + 1] = PermutationTable[B];
+        m_vCornerHashes[i * 4 + 2] = PermutationTable[A + 1];
+        m_vCornerHashes[i * 4 + 3] = PermutationTable[B + 1];
+    }
+
+    for (int plane = 0; plane < 2; plane++)
+    {
+        m_vPlaneValues[plane].resize(count);
+        m_vPlaneSlopes[plane].resize(count);
+    }
+
+    m_bPlanesValid = false;
+    m_ullPlaneBuilds = 0;
+}
+
+
+
+/**
+* \brief Sets the points to a width by height grid, row major by y, sample (x, y) at start + (x, y) * spacing
+*/
+template<typename Real>
+void AnimatedSlice<Real>::SetGrid(Real startX, Real startY, Real spacing, int width, int height)
+{
+    if (width <= 0 || height <= 0)
+    {
+        SetPoints(NULL, NULL, 0);
+        return;
+    }
+
+    std::vector<Real> x((size_t)width * height), y((size_t)width * height);
+    for (int row = 0; row < height; row++)
+    {
+        for (int column = 0; column < width; column++)
+        {
+            x[(size_t)row * width + column] = startX + Real(column) * spacing;
+            y[(size_t)row * width + column] = startY + Real(row) * spacing;
+        }
+    }
+
+    SetPoints(&x[0], &y[0], x.size());
+}
+
+
+
+/**
+* \brief Writes Perlin3D(x, y, z) for every point to out. \n
+* Moving z within the same lattice cell reuses both cached planes, moving it one cell up or down
+* keeps the shared plane and rebuilds the other, and any larger jump rebuilds both.
+*/
+template<typename Real>
+void AnimatedSlice<Real>::Evaluate(Real z, Real* out)
+{
+    const size_t count = m_vFractionX.size();
+    if (count == 0 || out == NULL) return;
+
+    const int cellZ = RealFloorToInt(z);
+
+    if (!m_bPlanesValid || cellZ > m_iLowerLevel + 1 || cellZ < m_iLowerLevel - 1)
+    {
+        BuildPlane(cellZ, 0);
+        BuildPlane(cellZ + 1, 1);
+    }
+    else if (cellZ == m_iLowerLevel + 1)
+    {
+        m_vPlaneValues[0].swap(m_vPlaneValues[1]);
+        m_vPlaneSlopes[0].swap(m_vPlaneSlopes[1]);
+        BuildPlane(cellZ + 1, 1);
+    }
+    else if (cellZ == m_iLowerLevel - 1)
+    {
+        m_vPlaneValues[0].swap(m_vPlaneValues[1]);
+        m_vPlaneSlopes[0].swap(m_vPlaneSlopes[1]);
+        BuildPlane(cellZ, 0);
+    }
+
+    m_iLowerLevel = cellZ;
+    m_bPlanesValid = true;
+
+    const Real fractionZ = z - Real(cellZ);
+    const Real fadedZ = FadeReal(fractionZ);
+    const Real aboveZ = fractionZ - Real(1);
+    const Real* lowerValues = &m_vPlaneValues[0][0];
+    const Real* lowerSlopes = &m_vPlaneSlopes[0][0];
+    const Real* upperValues = &m_vPlaneValues[1][0];
+    const Real* upperSlopes = &m_vPlaneSlopes[1][0];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = LerpReal(lowerValues[i] + lowerSlopes[i] * fractionZ, upperValues[i] + upperSlopes[i] * aboveZ, fadedZ);
+    }
+}
+
+
+
+
+#endif
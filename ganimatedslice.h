@@ -0,0 +1,114 @@
+/**
+ * @file ganimatedslice.h
+ * @brief Header file for animating a 2D slice of 3D Perlin noise along z with cached lattice planes
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GANIMATEDSLICE_H_INCLUDED
+#define GANIMATEDSLICE_H_INCLUDED
+
+#include <stddef.h>
+#include <vector>
+#include "grng.h"
+
+
+
+
+/**
+ * @brief A fixed set of x, y sample points evaluated as Perlin3D(x, y, z) for a z that moves each frame, usually time. \n
+ * Everything that only depends on x and y, the corner hashes and the gradient dot products folded through
+ * the x, y interpolation, is cached per sample for the two z lattice planes around the current z.
+ * A frame is then two multiply adds, a fade and a lerp per sample. Crossing into the next or previous z cell
+ * rebuilds only the one plane that is new. Real is float for Perlin3D, or double for the kernel ImprovedNoise
+ * samples once its random offset is applied. Set the same gradient set as the grng being matched.
+ */
+template<typename Real = float>
+class AnimatedSlice
+{
+
+private:
+
+    void BuildPlane(int level, int plane);
+
+
+protected:
+
+    ///Position inside the x, y lattice cell and its fade, per sample
+    std::vector<Real> m_vFractionX;
+    std::vector<Real> m_vFractionY;
+    std::vector<Real> m_vFadeX;
+    std::vector<Real> m_vFadeY;
+
+    ///The four x, y corner permutation values before z is added, per sample
+    std::vector<int> m_vCornerHashes;
+
+    ///Per plane and sample, the noise at the plane for a point on it, and its change per unit of z away from it
+    std::vector<Real> m_vPlaneValues[2];
+    std::vector<Real> m_vPlaneSlopes[2];
+
+    ///z lattice level of plane 0, plane 1 is the level above it
+    int m_iLowerLevel;
+    bool m_bPlanesValid;
+
+    ///Planes rebuilt since the points were set
+    unsigned long long m_ullPlaneBuilds;
+
+    ///Gradient directions the lattice corners use, as grng::SetGradientSet
+    GradientSet_t m_udtGradientSet;
+
+
+public:
+
+    AnimatedSlice();
+    ~AnimatedSlice();
+
+    void SetPoints(const Real* x, const Real* y, size_t count);
+    void SetGrid(Real startX, Real startY, Real spacing, int width, int height);
+
+    /**
+    * \brief Returns the amount of sample points
+    */
+    const inline size_t GetPointCount() const
+    {
+        return m_vFractionX.size();
+    }
+
+    /**
+    * \brief Returns the amount of z lattice planes rebuilt since the points were set
+    */
+    const inline unsigned long long GetPlaneBuilds() const
+    {
+        return m_ullPlaneBuilds;
+    }
+
+    /**
+    * \brief Sets the gradient directions the lattice corners use, the cached planes are rebuilt on the next Evaluate
+    */
+    inline void SetGradientSet(GradientSet_t gradientSet)
+    {
+        m_udtGradientSet = gradientSet;
+        m_bPlanesValid = false;
+    }
+
+    /**
+    * \brief Returns the gradient directions the lattice corners use
+    */
+    const inline GradientSet_t GetGradientSet() const
+    {
+        return m_udtGradientSet;
+    }
+
+    void Evaluate(Real z, Real* out);
+};
+
+
+
+
+#include "ganimatedslice.cpp"
+
+
+#endif // GANIMATEDSLICE_H_INCLUDED
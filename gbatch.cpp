@@ -0,0 +1,176 @@
+/**
+ * @file gbatch.cpp
+ * @brief Source file for evaluating noise over scattered points given as arrays or strided structures
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GBATCH_CPP_INCLUDED
+#define GBATCH_CPP_INCLUDED
+
+#include "gbatch.h"
+
+
+///Points gathered out of strided input and handed to the noise at a time
+static const size_t BatchGatherSize = 256;
+
+
+
+/**
+* \brief Picks the requested feature out of a cellular result
+*/
+static inline float SelectCellularFeature(const CellularResult_t& result, CellularFeature_t feature)
+{
+    switch (feature)
+    {
+    case Cellular_Feature_F2:
+        return result.f2;
+    case Cellular_Feature_F2MinusF1:
+        return result.f2MinusF1;
+    default:
+        return result.f1;
+    }
+}
+
+
+
+/**
+* \brief Evaluates the 2D cellular noise for arrays of points, BatchGatherSize results at a time
+*/
+template<typename T>
+void BatchCellular<T>::Evaluate(const float* x, const float* y, float* out, size_t count) const
+{
+    CellularResult_t results[BatchGatherSize];
+
+    for (size_t start = 0; start < count; start += BatchGatherSize)
+    {
+        size_t blockCount = (count - start < BatchGatherSize) ? count - start : BatchGatherSize;
+        cellular->Evaluate2D(x + start, y + start, results, blockCount);
+        for (size_t i = 0; i < blockCount; i++) out[start + i] = SelectCellularFeature(results[i], feature);
+    }
+}
+
+
+
+/**
+* \brief Evaluates the 3D cellular noise for arrays of points, BatchGatherSize results at a time
+*/
+template<typename T>
+void BatchCellular<T>::Evaluate(const float* x, const float* y, const float* z, float* out, size_t count) const
+{
+    CellularResult_t results[BatchGatherSize];
+
+    for (size_t start = 0; start < count; start += BatchGatherSize)
+    {
+        size_t blockCount = (count - start < BatchGatherSize) ? count - start : BatchGatherSize;
+        cellular->Evaluate3D(x + start, y + start, z + start, results, blockCount);
+        for (size_t i = 0; i < blockCount; i++) out[start + i] = SelectCellularFeature(results[i], feature);
+    }
+}
+
+
+
+/**
+* \brief Evaluates noise at count points given as separate x and y arrays. \n
+* The points are split across threadCount threads, zero or less for one per hardware thread, and
+* each thread hands its range straight to the array path of the noise.
+*/
+template<typename BatchNoise>
+void EvaluatePoints2D(const BatchNoise& noise, const float* x, const float* y, float* out, size_t count, int threadCount)
+{
+    EvaluatePoints2DStrided(noise, x, y, 1, out, 1, count, threadCount);
+}
+
+
+
+/**
+* \brief Evaluates noise at count points given as separate x, y and z arrays, see EvaluatePoints2D
+*/
+template<typename BatchNoise>
+void EvaluatePoints3D(const BatchNoise& noise, const float* x, const float* y, const float* z, float* out, size_t count,
+    int threadCount)
+{
+    EvaluatePoints3DStrided(noise, x, y, z, 1, out, 1, count, threadCount);
+}
+
+
+
+/**
+* \brief Evaluates noise at count points whose coordinates are inputStride floats apart, writing results outputStride floats apart. \n
+* For an array of vertex structures pass the address of the first vertex x and y and the vertex size in floats.
+* Strided points are gathered BatchGatherSize at a time into contiguous blocks for the noise and the results
+* scattered back, while unit strides skip the copies.
+*/
+template<typename BatchNoise>
+void EvaluatePoints2DStrided(const BatchNoise& noise, const float* x, const float* y, size_t inputStride,
+    float* out, size_t outputStride, size_t count, int threadCount)
+{
+    if (x == NULL || y == NULL || out == NULL || count == 0) return;
+
+    ParallelForRange(count, threadCount, [&](size_t begin, size_t end)
+    {
+        if (inputStride == 1 && outputStride == 1)
+        {
+            noise.Evaluate(x + begin, y + begin, out + begin, end - begin);
+            return;
+        }
+
+        float blockX[BatchGatherSize], blockY[BatchGatherSize], blockOut[BatchGatherSize];
+        for (size_t start = begin; start < end; start += BatchGatherSize)
+        {
+            size_t blockCount = (end - start < BatchGatherSize) ? end - start : BatchGatherSize;
+            for (size_t i = 0; i < blockCount; i++)
+            {
+                blockX[i] = x[(start + i) * inputStride];
+                blockY[i] = y[(start + i) * inputStride];
+            }
+
+            noise.Evaluate(blockX, blockY, blockOut, blockCount);
+            for (size_t i = 0; i < blockCount; i++) out[(start + i) * outputStride] = blockOut[i];
+        }
+    });
+}
+
+
+
+/**
+* \brief Evaluates noise at count points whose coordinates are inputStride floats apart, see EvaluatePoints2DStrided
+*/
+template<typename BatchNoise>
+void EvaluatePoints3DStrided(const BatchNoise& noise, const float* x, const float* y, const float* z, size_t inputStride,
+    float* out, size_t outputStride, size_t count, int threadCount)
+{
+    if (x == NULL || y == NULL || z == NULL || out == NULL || count == 0) return;
+
+    ParallelForRange(count, threadCount, [&](size_t begin, size_t end)
+    {
+        if (inputStride == 1 && outputStride == 1)
+        {
+            noise.Evaluate(x + begin, y + begin, z + begin, out + begin, end - begin);
+            return;
+        }
+
+        float blockX[BatchGatherSize], blockY[BatchGatherSize], blockZ[BatchGatherSize], blockOut[BatchGatherSize];
+        for (size_t start = begin; start < end; start += BatchGatherSize)
+        {
+            size_t blockCount = (end - start < BatchGatherSize) ? end - start : BatchGatherSize;
+            for (size_t i = 0; i < blockCount; i++)
+            {
+                blockX[i] = x[(start + i) * inputStride];
+                blockY[i] = y[(start + i) * inputStride];
+                blockZ[i] = z[(start + i) * inputStride];
+            }
+
+            noise.Evaluate(blockX, blockY, blockZ, blockOut, blockCount);
+            for (size_t i = 0; i < blockCount; i++) out[(start + i) * outputStride] = blockOut[i];
+        }
+    });
+}
+
+
+
+
+#endif
@@ -0,0 +1,131 @@
+/**
+ * @file gbatch.h
+ * @brief Header file for evaluating noise over scattered points given as arrays or strided structures
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GBATCH_H_INCLUDED
+#define GBATCH_H_INCLUDED
+
+#include <stddef.h>
+#include "grng.h"
+#include "gsimplex.h"
+#include "gcellular.h"
+#include "gfractal.h"
+#include "gparallel.h"
+
+
+/**
+ * @brief Which cellular value a BatchCellular writes
+ */
+typedef enum CellularFeatures {
+
+    Cellular_Feature_F1,
+    Cellular_Feature_F2,
+    Cellular_Feature_F2MinusF1
+
+} CellularFeature_t;
+
+
+
+#pragma region BATCH_ADAPTERS
+
+/**
+ * @brief Batch adapters give every noise the Evaluate(x, y, out, count) and Evaluate(x, y, z, out, count)
+ * form Fractal already has, so EvaluatePoints can drive any of them. Each forwards a block of points
+ * to the array path of the noise it wraps.
+ */
+
+/**
+ * @brief Batch adapter for grng Perlin2D/Perlin3D, with Perlin2DDerivative for warps that follow the gradient
+ */
+template<typename T>
+struct BatchPerlin {
+    grng<T>* generator;
+    inline void Evaluate(const float* x, const float* y, float* out, size_t count) const {
+        generator->template PerlinKernel2D<float>(x, y, out, count);
+    }
+    inline void Evaluate(const float* x, const float* y, const float* z, float* out, size_t count) const {
+        generator->template PerlinKernel3D<float>(x, y, z, out, count);
+    }
+    inline void EvaluateDerivative(const float* x, const float* y, float* value, float* dx, float* dy, size_t count) const {
+        generator->Perlin2DDerivative(x, y, value, dx, dy, count);
+    }
+};
+
+
+
+/**
+ * @brief Batch adapter for grng SmoothValueNoise2D/3D
+ */
+template<typename T>
+struct BatchValue {
+    const grng<T>* generator;
+    int seedValue;
+    inline void Evaluate(const float* x, const float* y, float* out, size_t count) const {
+        generator->SmoothValueNoise2D(x, y, out, count, seedValue);
+    }
+    inline void Evaluate(const float* x, const float* y, const float* z, float* out, size_t count) const {
+        generator->SmoothValueNoise3D(x, y, z, out, count, seedValue);
+    }
+};
+
+
+
+/**
+ * @brief Batch adapter for gsimplex Noise2D/Noise3D
+ */
+template<typename T>
+struct BatchSimplex {
+    const gsimplex<T>* simplex;
+    inline void Evaluate(const float* x, const float* y, float* out, size_t count) const {
+        simplex->Noise2D(x, y, out, count);
+    }
+    inline void Evaluate(const float* x, const float* y, const float* z, float* out, size_t count) const {
+        simplex->Noise3D(x, y, z, out, count);
+    }
+};
+
+
+
+/**
+ * @brief Batch adapter for gcellular Evaluate2D/Evaluate3D, writing one feature of each result
+ */
+template<typename T>
+struct BatchCellular {
+    const gcellular<T>* cellular;
+    CellularFeature_t feature;
+    void Evaluate(const float* x, const float* y, float* out, size_t count) const;
+    void Evaluate(const float* x, const float* y, const float* z, float* out, size_t count) const;
+};
+
+#pragma endregion
+
+
+
+template<typename BatchNoise>
+void EvaluatePoints2D(const BatchNoise& noise, const float* x, const float* y, float* out, size_t count, int threadCount);
+
+template<typename BatchNoise>
+void EvaluatePoints3D(const BatchNoise& noise, const float* x, const float* y, const float* z, float* out, size_t count,
+    int threadCount);
+
+template<typename BatchNoise>
+void EvaluatePoints2DStrided(const BatchNoise& noise, const float* x, const float* y, size_t inputStride,
+    float* out, size_t outputStride, size_t count, int threadCount);
+
+template<typename BatchNoise>
+void EvaluatePoints3DStrided(const BatchNoise& noise, const float* x, const float* y, const float* z, size_t inputStride,
+    float* out, size_t outputStride, size_t count, int threadCount);
+
+
+
+
+#include "gbatch.cpp"
+
+
+#endif // GBATCH_H_INCLUDED
@@ -0,0 +1,462 @@
+/**
+ * @file gcellular.cpp
+ * @brief Source file for stateless cellular (Worley) noise
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCELLULAR_CPP_INCLUDED
+#define GCELLULAR_CPP_INCLUDED
+
+#include "gcellular.h"
+
+
+/// <summary>
+/// Neighbour cell offsets of the 3x3 search
+/// </summary>
+static const int CellularOffsets2D[9][2] = {
+    { -1, -1 }, { 0, -1 }, { 1, -1 },
+    { -1,  0 }, { 0,  0 }, { 1,  0 },
+    { -1,  1 }, { 0,  1 }, { 1,  1 }
+};
+
+
+
+/// <summary>
+/// Neighbour cell offsets of the 3x3x3 search
+/// </summary>
+static const int CellularOffsets3D[27][3] = {
+    { -1, -1, -1 }, { 0, -1, -1 }, { 1, -1, -1 }, { -1, 0, -1 }, { 0, 0, -1 }, { 1, 0, -1 }, { -1, 1, -1 }, { 0, 1, -1 }, { 1, 1, -1 },
+    { -1, -1,  0 }, { 0, -1,  0 }, { 1, -1,  0 }, { -1, 0,  0 }, { 0, 0,  0 }, { 1, 0,  0 }, { -1, 1,  0 }, { 0, 1,  0 }, { 1, 1,  0 },
+    { -1, -1,  1 }, { 0, -1,  1 }, { 1, -1,  1 }, { -1, 0,  1 }, { 0, 0,  1 }, { 1, 0,  1 }, { -1, 1,  1 }, { 0, 1,  1 }, { 1, 1,  1 }
+};
+
+
+
+/// <summary>
+/// Largest jitter the 3x3 search stays exact for, indexed by CellularDistance_t. \n
+/// The worst query sits on a cell corner. Every searched point may then be as far as sqrt(2) * (0.5 + jitter)
+/// while a point two cells over may be as near as sqrt((1.5 - jitter)^2 + (0.5 - jitter)^2), which meet
+/// at 1/3. Manhattan meets at 1/4 and Chebyshev never leaves the neighbourhood. The same bound holds
+/// for F2, since the four cells around the corner all reach it together.
+/// </summary>
+static const float CellularMaxJitter2D[3] = { 1.0f / 3.0f, 0.25f, 0.5f };
+
+
+
+/// <summary>
+/// Largest jitter the 3x3x3 search stays exact for, indexed by CellularDistance_t, worked out as for 2D
+/// </summary>
+static const float CellularMaxJitter3D[3] = { 0.25f, 1.0f / 6.0f, 0.5f };
+
+
+
+#pragma region STATIC_MATH
+
+
+/// <summary>
+/// Distance for the metric, squared for euclidean so the search can skip the square root
+/// </summary>
+template<int Metric>
+static inline float CellularDistance2D(float dx, float dy) {
+    if (Metric == Cellular_Distance_Manhattan) return std::fabs(dx) + std::fabs(dy);
+    if (Metric == Cellular_Distance_Chebyshev) return MAX(std::fabs(dx), std::fabs(dy));
+    return dx * dx + dy * dy;
+}
+
+
+
+template<int Metric>
+static inline float CellularDistance3D(float dx, float dy, float dz) {
+    if (Metric == Cellular_Distance_Manhattan) return std::fabs(dx) + std::fabs(dy) + std::fabs(dz);
+    if (Metric == Cellular_Distance_Chebyshev)
+    {
+        float dxy = MAX(std::fabs(dx), std::fabs(dy));
+        return MAX(dxy, std::fabs(dz));
+    }
+    return dx * dx + dy * dy + dz * dz;
+}
+
+
+
+/// <summary>
+/// Picks the two smallest candidate distances and the hash of the nearest
+/// </summary>
+template<int Metric, int CandidateCount>
+static inline CellularResult_t CellularSelect(const float* distances, const unsigned int* hashes) {
+    float f1 = 3.4e38f;
+    float f2 = 3.4e38f;
+    unsigned int cellId = 0;
+
+    for (int k = 0; k < CandidateCount; k++)
+    {
+        float d = distances[k];
+        if (d < f1)
+        {
+            f2 = f1;
+            f1 = d;
+            cellId = hashes[k];
+        }
+        else if (d < f2)
+        {
+            f2 = d;
+        }
+    }
+
+    if (Metric == Cellular_Distance_Euclidean)
+    {
+        f1 = std::sqrt(f1);
+        f2 = std::sqrt(f2);
+    }
+
+    CellularResult_t result;
+    result.f1 = f1;
+    result.f2 = f2;
+    result.f2MinusF1 = f2 - f1;
+    result.cellId = cellId;
+    return result;
+}
+
+#pragma endregion
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gcellular<T>::gcellular()
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = 0;
+    m_gdtSeed |= 6256256;
+    m_udtDistance = Cellular_Distance_Euclidean;
+    m_fJitter = 0.25f;
+}
+
+
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gcellular<T>::gcellular(const T newSeed)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    m_udtDistance = Cellular_Distance_Euclidean;
+    m_fJitter = 0.25f;
+}
+
+
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gcellular<T>::gcellular(const T newSeed, CellularDistance_t distance, float jitter)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    m_udtDistance = distance;
+    SetJitter(jitter);
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gcellular<T>::~gcellular()
+{
+    m_gdtSeed = 0;
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Sets the distance metric
+*/
+template<typename T>
+void gcellular<T>::SetDistance(CellularDistance_t distance)
+{
+    m_udtDistance = distance;
+}
+
+
+
+/**
+* \brief Sets how far feature points may move from their cell center, clamped to 0 - 0.5. \n
+* Each search uses at most the largest jitter its 3x3(x3) neighbourhood is exact for with the metric,
+* 1/3 in 2D and 1/4 in 3D for euclidean, 1/4 and 1/6 for manhattan and 0.5 for chebyshev. Larger
+* values are reduced to that, since points could otherwise be nearer in cells the search skips.
+*/
+template<typename T>
+void gcellular<T>::SetJitter(float jitter)
+{
+    m_fJitter = Clamp(jitter, 0.0f, 0.5f);
+}
+
+
+
+/**
+* \brief Searches the 3x3 cells around the point. \n
+* Every candidate's feature point is hashed from its cell and the seed, and the candidate
+* distances are filled in one fixed length, branch free loop before F1/F2 are picked out.
+* When Periodic is set the cell is wrapped by the period before hashing, so feature points repeat.
+*/
+template<typename T>
+template<int Metric, bool Periodic>
+CellularResult_t gcellular<T>::Search2D(float x, float y, int periodX, int periodY) const
+{
+    const int cellX = FastFloorToInt(x);
+    const int cellY = FastFloorToInt(y);
+    const float localX = x - (float)cellX;
+    const float localY = y - (float)cellY;
+    const float jitter = MIN(m_fJitter, CellularMaxJitter2D[Metric]);
+    const float jitterScale = 2.0f * jitter / 65535.0f;
+    const unsigned int seed = (unsigned int)m_gdtSeed;
+
+    float distances[9];
+    unsigned int hashes[9];
+
+    for (int k = 0; k < 9; k++)
+    {
+        int hashX = cellX + CellularOffsets2D[k][0];
+        int hashY = cellY + CellularOffsets2D[k][1];
+        if (Periodic)
+        {
+            hashX = WrapIndex(hashX, periodX);
+            hashY = WrapIndex(hashY, periodY);
+        }
+
+        unsigned int h = HashCoordinates2D<unsigned int>(seed, hashX, hashY);
+        float pointX = (float)CellularOffsets2D[k][0] + 0.5f + ((float)(h & 0xffff) - 32767.5f) * jitterScale;
+        float pointY = (float)CellularOffsets2D[k][1] + 0.5f + ((float)(h >> 16) - 32767.5f) * jitterScale;
+        distances[k] = CellularDistance2D<Metric>(pointX - localX, pointY - localY);
+        hashes[k] = h;
+    }
+
+    return CellularSelect<Metric, 9>(distances, hashes);
+}
+
+
+
+/**
+* \brief Searches the 3x3x3 cells around the point
+*/
+template<typename T>
+template<int Metric, bool Periodic>
+CellularResult_t gcellular<T>::Search3D(float x, float y, float z, int periodX, int periodY, int periodZ) const
+{
+    const int cellX = FastFloorToInt(x);
+    const int cellY = FastFloorToInt(y);
+    const int cellZ = FastFloorToInt(z);
+    const float localX = x - (float)cellX;
+    const float localY = y - (float)cellY;
+    const float localZ = z - (float)cellZ;
+    const float jitter = MIN(m_fJitter, CellularMaxJitter3D[Metric]);
+    const float jitterScale = 2.0f * jitter / 1023.0f;
+    const unsigned int seed = (unsigned int)m_gdtSeed;
+
+    float distances[27];
+    unsigned int hashes[27];
+
+    for (int k = 0; k < 27; k++)
+    {
+        int hashX = cellX + CellularOffsets3D[k][0];
+        int hashY = cellY + CellularOffsets3D[k][1];
+        int hashZ = cellZ + CellularOffsets3D[k][2];
+        if (Periodic)
+        {
+            hashX = WrapIndex(hashX, periodX);
+            hashY = WrapIndex(hashY, periodY);
+            hashZ = WrapIndex(hashZ, periodZ);
+        }
+
+        unsigned int h = HashCoordinates3D<unsigned int>(seed, hashX, hashY, hashZ);
+        float pointX = (float)CellularOffsets3D[k][0] + 0.5f + ((float)(h & 0x3ff) - 511.5f) * jitterScale;
+        float pointY = (float)CellularOffsets3D[k][1] + 0.5f + ((float)((h >> 10) & 0x3ff) - 511.5f) * jitterScale;
+        float pointZ = (float)CellularOffsets3D[k][2] + 0.5f + ((float)((h >> 20) & 0x3ff) - 511.5f) * jitterScale;
+        distances[k] = CellularDistance3D<Metric>(pointX - localX, pointY - localY, pointZ - localZ);
+        hashes[k] = h;
+    }
+
+    return CellularSelect<Metric, 27>(distances, hashes);
+}
+
+
+
+/// <summary>
+/// 2D cellular noise, F1, F2, F2 - F1 and the nearest cell id from one search
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <returns></returns>
+template<typename T>
+CellularResult_t gcellular<T>::Evaluate2D(float x, float y) const
+{
+    switch (m_udtDistance)
+    {
+    case Cellular_Distance_Manhattan:
+        return Search2D<Cellular_Distance_Manhattan, false>(x, y, 0, 0);
+
+    case Cellular_Distance_Chebyshev:
+        return Search2D<Cellular_Distance_Chebyshev, false>(x, y, 0, 0);
+
+    default:
+        return Search2D<Cellular_Distance_Euclidean, false>(x, y, 0, 0);
+    }
+}
+
+
+
+/// <summary>
+/// 3D cellular noise, F1, F2, F2 - F1 and the nearest cell id from one search
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+CellularResult_t gcellular<T>::Evaluate3D(float x, float y, float z) const
+{
+    switch (m_udtDistance)
+    {
+    case Cellular_Distance_Manhattan:
+        return Search3D<Cellular_Distance_Manhattan, false>(x, y, z, 0, 0, 0);
+
+    case Cellular_Distance_Chebyshev:
+        return Search3D<Cellular_Distance_Chebyshev, false>(x, y, z, 0, 0, 0);
+
+    default:
+        return Search3D<Cellular_Distance_Euclidean, false>(x, y, z, 0, 0, 0);
+    }
+}
+
+
+
+/**
+* \brief 2D cellular noise over arrays of x and y coordinates. \n
+* The metric is picked once for the whole batch.
+*/
+template<typename T>
+void gcellular<T>::Evaluate2D(const float* x, const float* y, CellularResult_t* out, size_t count) const
+{
+    size_t i = 0;
+
+    switch (m_udtDistance)
+    {
+    case Cellular_Distance_Manhattan:
+        for (i = 0; i < count; i++) out[i] = Search2D<Cellular_Distance_Manhattan, false>(x[i], y[i], 0, 0);
+        break;
+
+    case Cellular_Distance_Chebyshev:
+        for (i = 0; i < count; i++) out[i] = Search2D<Cellular_Distance_Chebyshev, false>(x[i], y[i], 0, 0);
+        break;
+
+    default:
+        for (i = 0; i < count; i++) out[i] = Search2D<Cellular_Distance_Euclidean, false>(x[i], y[i], 0, 0);
+        break;
+    }
+}
+
+
+
+/**
+* \brief 3D cellular noise over arrays of x, y and z coordinates
+*/
+template<typename T>
+void gcellular<T>::Evaluate3D(const float* x, const float* y, const float* z, CellularResult_t* out, size_t count) const
+{
+    size_t i = 0;
+
+    switch (m_udtDistance)
+    {
+    case Cellular_Distance_Manhattan:
+        for (i = 0; i < count; i++) out[i] = Search3D<Cellular_Distance_Manhattan, false>(x[i], y[i], z[i], 0, 0, 0);
+        break;
+
+    case Cellular_Distance_Chebyshev:
+        for (i = 0; i < count; i++) out[i] = Search3D<Cellular_Distance_Chebyshev, false>(x[i], y[i], z[i], 0, 0, 0);
+        break;
+
+    default:
+        for (i = 0; i < count; i++) out[i] = Search3D<Cellular_Distance_Euclidean, false>(x[i], y[i], z[i], 0, 0, 0);
+        break;
+    }
+}
+
+
+
+/// <summary>
+/// 2D cellular noise whose feature points repeat every periodX cells along x and periodY along y
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="periodX">Cells before x repeats, at least 1</param>
+/// <param name="periodY">Cells before y repeats, at least 1</param>
+/// <returns></returns>
+template<typename T>
+CellularResult_t gcellular<T>::Evaluate2DPeriodic(float x, float y, int periodX, int periodY) const
+{
+    periodX = MAX(periodX, 1);
+    periodY = MAX(periodY, 1);
+
+    switch (m_udtDistance)
+    {
+    case Cellular_Distance_Manhattan:
+        return Search2D<Cellular_Distance_Manhattan, true>(x, y, periodX, periodY);
+
+    case Cellular_Distance_Chebyshev:
+        return Search2D<Cellular_Distance_Chebyshev, true>(x, y, periodX, periodY);
+
+    default:
+        return Search2D<Cellular_Distance_Euclidean, true>(x, y, periodX, periodY);
+    }
+}
+
+
+
+/// <summary>
+/// 3D cellular noise whose feature points repeat every period cells along each axis
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <param name="periodX"></param>
+/// <param name="periodY"></param>
+/// <param name="periodZ"></param>
+/// <returns></returns>
+template<typename T>
+CellularResult_t gcellular<T>::Evaluate3DPeriodic(float x, float y, float z, int periodX, int periodY, int periodZ) const
+{
+    periodX = MAX(periodX, 1);
+    periodY = MAX(periodY, 1);
+    periodZ = MAX(periodZ, 1);
+
+    switch (m_udtDistance)
+    {
+    case Cellular_Distance_Manhattan:
+        return Search3D<Cellular_Distance_Manhattan, true>(x, y, z, periodX, periodY, periodZ);
+
+    case Cellular_Distance_Chebyshev:
+        return Search3D<Cellular_Distance_Chebyshev, true>(x, y, z, periodX, periodY, periodZ);
+
+    default:
+        return Search3D<Cellular_Distance_Euclidean, true>(x, y, z, periodX, periodY, periodZ);
+    }
+}
+
+
+
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file gcellular.h
+ * @brief Header file for stateless cellular (Worley) noise
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCELLULAR_H_INCLUDED
+#define GCELLULAR_H_INCLUDED
+
+#include <stddef.h>
+#include "grng.h"
+#include "grandomAlgorithms.h"
+
+
+/**
+ * @brief Distance metrics the cellular noise can measure with
+ */
+typedef enum CellularDistances {
+
+    Cellular_Distance_Euclidean,
+    Cellular_Distance_Manhattan,
+    Cellular_Distance_Chebyshev
+
+} CellularDistance_t;
+
+
+
+/**
+ * @brief Everything one cellular sample finds in its single search pass
+ */
+typedef struct CellularResult {
+
+    ///Distance to the nearest feature point
+    float f1;
+
+    ///Distance to the second nearest feature point
+    float f2;
+
+    ///f2 - f1, the cell edge value
+    float f2MinusF1;
+
+    ///Hash of the cell holding the nearest feature point, stable per cell and seed
+    unsigned int cellId;
+
+} CellularResult_t;
+
+
+
+/**
+ * @brief A Voronoi2D/3D style value from a cellular sample. \n
+ * f1 * sqrt(3) - 1 when useDistance is set, else 0, plus displacement times a -1 - 1 value picked per cell.
+ * The cell id is remixed first since its low and high halves also placed the feature point.
+ */
+inline float CellularVoronoiValue(const CellularResult_t& result, bool useDistance, float displacement)
+{
+    const float cellValue = (float)((result.cellId * 0x9e3779b1u) >> 8) * (1.0f / 8388607.5f) - 1.0f;
+    return (useDistance ? result.f1 * (float)SQRT3 - 1.0f : 0.0f) + displacement * cellValue;
+}
+
+
+
+
+template<typename T>
+class gcellular
+{
+
+private:
+
+    template<int Metric, bool Periodic>
+    CellularResult_t Search2D(float x, float y, int periodX, int periodY) const;
+
+    template<int Metric, bool Periodic>
+    CellularResult_t Search3D(float x, float y, float z, int periodX, int periodY, int periodZ) const;
+
+
+protected:
+
+    ///Seed the feature points are hashed with
+    T m_gdtSeed;
+
+    ///How far feature points may move from their cell center, 0 - 0.5, reduced per search to what the metric allows
+    float m_fJitter;
+
+    ///The distance metric
+    CellularDistance_t m_udtDistance;
+
+
+public:
+
+    gcellular();
+    gcellular(const T newSeed);
+    gcellular(const T newSeed, CellularDistance_t distance, float jitter);
+    ~gcellular();
+
+    /**
+    * \brief Sets this objects seed to the seed passed
+    */
+    inline void SetSeed(const T newSeed)
+    {
+        m_gdtSeed = newSeed;
+    }
+
+    /**
+    * \brief Returns this objects seed
+    */
+    const inline T GetSeed()
+    {
+        return m_gdtSeed;
+    }
+
+    void SetDistance(CellularDistance_t distance);
+    void SetJitter(float jitter);
+
+    CellularResult_t Evaluate2D(float x, float y) const;
+    CellularResult_t Evaluate3D(float x, float y, float z) const;
+
+    void Evaluate2D(const float* x, const float* y, CellularResult_t* out, size_t count) const;
+    void Evaluate3D(const float* x, const float* y, const float* z, CellularResult_t* out, size_t count) const;
+
+    CellularResult_t Evaluate2DPeriodic(float x, float y, int periodX, int periodY) const;
+    CellularResult_t Evaluate3DPeriodic(float x, float y, float z, int periodX, int periodY, int periodZ) const;
+};
+
+
+
+
+#include "gcellular.cpp"
+
+
+#endif // GCELLULAR_H_INCLUDED
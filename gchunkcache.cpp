@@ -0,0 +1,375 @@
+/**
+ * @file gchunkcache.cpp
+ * @brief Source file for the streaming noise chunk generator and its LRU chunk cache
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCHUNKCACHE_CPP_INCLUDED
+#define GCHUNKCACHE_CPP_INCLUDED
+
+#include "gchunkcache.h"
+
+
+#pragma region STATIC_MATH
+
+
+/// <summary>
+/// Floors the division of a world coordinate by the chunk size so negative coordinates land in the right chunk
+/// </summary>
+/// <param name="value"></param>
+/// <param name="divisor"></param>
+/// <returns></returns>
+static int FloorDivideInt(int value, int divisor) {
+    int quotient = value / divisor;
+    if ((value % divisor != 0) && ((value < 0) != (divisor < 0))) quotient--;
+    return quotient;
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Hashes the key by mixing every field through wyhash
+*/
+inline size_t ChunkKeyHasher::operator()(const ChunkKey_t& key) const
+{
+    unsigned long long h = wyhash<unsigned long long>(key.seed);
+    h = wyhash<unsigned long long>(h ^ (unsigned long long)(unsigned int)key.layer);
+    h = wyhash<unsigned long long>(h ^ (unsigned long long)(unsigned int)key.chunkX);
+    h = wyhash<unsigned long long>(h ^ ((unsigned long long)(unsigned int)key.chunkY << 32));
+    return (size_t)h;
+}
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+* \param chunkSize Samples along one chunk edge, not counting the shared border sample
+* \param byteBudget Bytes the cache may hold before evicting the least recently used chunks
+*/
+template<typename T>
+gchunkcache<T>::gchunkcache(int chunkSize, size_t byteBudget)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_iChunkSize = (chunkSize < 1) ? 1 : chunkSize;
+    m_szByteBudget = byteBudget;
+    m_szBytesUsed = 0;
+    m_ullHits = 0;
+    m_ullMisses = 0;
+    m_ullEvictions = 0;
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gchunkcache<T>::~gchunkcache()
+{
+    Clear();
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Adds a noise layer and returns its index for GetChunk
+*/
+template<typename T>
+int gchunkcache<T>::AddLayer(const ChunkLayer_t& layer)
+{
+    ChunkLayer_t checkedLayer = layer;
+    if(checkedLayer.roughness == 0) checkedLayer.roughness = 10000;
+    if(checkedLayer.octaveAmount < 1) checkedLayer.octaveAmount = 1;
+    if(checkedLayer.noisePersistance <= 0) checkedLayer.noisePersistance = 0.001f;
+    if(checkedLayer.noiseLacunarity < 0.01f) checkedLayer.noiseLacunarity = 0.01f;
+
+    std::lock_guard<std::mutex> lock(m_mtxCache);
+    m_vLayers.push_back(checkedLayer);
+    return (int)m_vLayers.size() - 1;
+}
+
+
+
+/**
+* \brief Returns the bytes one chunk occupies in the cache
+*/
+template<typename T>
+size_t gchunkcache<T>::ChunkBytes() const
+{
+    size_t samplesPerSide = (size_t)m_iChunkSize + 1;
+    return sizeof(NoiseChunk_t) + samplesPerSide * samplesPerSide * sizeof(float);
+}
+
+
+
+/**
+* \brief Evicts least recently used chunks until the incoming bytes fit the budget. \n
+* Expects the cache mutex to be held.
+*/
+template<typename T>
+void gchunkcache<T>::EvictToFit(size_t incomingBytes)
+{
+    while (!m_lChunks.empty() && m_szBytesUsed + incomingBytes > m_szByteBudget)
+    {
+        const ChunkPointer_t& oldest = m_lChunks.back();
+        m_mChunkLookup.erase(oldest->key);
+        m_lChunks.pop_back();
+        m_szBytesUsed -= ChunkBytes();
+        m_ullEvictions++;
+    }
+}
+
+
+
+/**
+* \brief Fills the chunk with the octave noise of its layer. \n
+* Samples are taken at integer world coordinates and the octave offsets only depend on the
+* seed and layer, so a border sample is computed identically by both chunks that share it.
+* The layer is a copy taken under the cache mutex, since AddLayer may grow the layer list meanwhile.
+*/
+template<typename T>
+void gchunkcache<T>::GenerateChunk(NoiseChunk_t& chunk, const ChunkLayer_t& layer) const
+{
+    const int octaveAmount = layer.octaveAmount;
+
+    //The octave offsets come from a generator seeded by the seed and layer alone
+    grng<T> octaveRng((T)(chunk.key.seed ^ wyhash<unsigned long long>((unsigned long long)chunk.key.layer + 1)));
+
+    std::vector<float> octaveOffsetsX(octaveAmount);
+    std::vector<float> octaveOffsetsY(octaveAmount);
+    std::vector<double> octaveDevisors(octaveAmount);
+    std::vector<float> octaveAmplitudes(octaveAmount);
+    std::vector<float> octaveCycles(octaveAmount);
+    std::vector<int> keptOctaves(octaveAmount);
+    float amplitude = 1;
+    float frequency = 1;
+    float amplitudeSum = 0;
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        octaveOffsetsX[i] = octaveRng.RangeFloat(-layer.roughness, layer.roughness);
+        octaveOffsetsY[i] = octaveRng.RangeFloat(-layer.roughness, layer.roughness);
+        octaveAmplitudes[i] = amplitude;
+        float devisor = (layer.noiseScale != 0 && frequency != 0) ? layer.noiseScale * frequency : 1;
+        octaveDevisors[i] = devisor;
+        octaveCycles[i] = 1.0f / devisor;
+        amplitude *= layer.noisePersistance;
+        frequency *= layer.noiseLacunarity;
+    }
+
+    //Samples are one world unit apart, octaves finer than that only alias
+    const int keptAmount = SelectVisibleOctaves(&octaveCycles[0], &octaveAmplitudes[0], octaveAmount,
+        layer.amplitudeEpsilon, &keptOctaves[0]);
+    for (int k = 0; k < keptAmount; k++) amplitudeSum += octaveAmplitudes[keptOctaves[k]];
+
+    const int samplesPerSide = chunk.samplesPerSide;
+    //Distant chunks leave the int range and float precision, so the world position is worked out in
+    //double and split into a 64 bit lattice cell and the float offset inside it for Perlin2DLarge
+    const long long worldStartX = (long long)chunk.key.chunkX * m_iChunkSize;
+    const long long worldStartY = (long long)chunk.key.chunkY * m_iChunkSize;
+    const float inverseAmplitudeSum = 1.0f / amplitudeSum;
+
+    chunk.values.assign((size_t)samplesPerSide * samplesPerSide, 0.0f);
+
+    for (int y = 0; y < samplesPerSide; y++)
+    {
+        float* row = &chunk.values[(size_t)y * samplesPerSide];
+
+        for (int x = 0; x < samplesPerSide; x++)
+        {
+            float noiseValue = 0;
+            for (int k = 0; k < keptAmount; k++)
+            {
+                int j = keptOctaves[k];
+                const double sampleX = ((double)(worldStartX + x) + octaveOffsetsX[j]) / octaveDevisors[j];
+                const double sampleY = ((double)(worldStartY + y) - octaveOffsetsY[j]) / octaveDevisors[j];
+                const double cellX = std::floor(sampleX);
+                const double cellY = std::floor(sampleY);
+                noiseValue += octaveAmplitudes[j] * (octaveRng.Perlin2DLarge((long long)cellX, (long long)cellY,
+                    (float)(sampleX - cellX), (float)(sampleY - cellY)) * 2 - 1);
+            }
+
+            row[x] = noiseValue * inverseAmplitudeSum;
+        }
+    }
+}
+
+
+
+/**
+* \brief Returns the chunk for the seed, layer and chunk coordinates, generating it on a miss. \n
+* The returned chunk stays valid after it is evicted from the cache.
+*/
+template<typename T>
+std::shared_ptr<const NoiseChunk_t> gchunkcache<T>::GetChunk(T seed, int layer, int chunkX, int chunkY)
+{
+    ChunkKey_t key;
+    key.seed = (unsigned long long)seed;
+    key.layer = layer;
+    key.chunkX = chunkX;
+    key.chunkY = chunkY;
+    ChunkLayer_t layerSettings;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtxCache);
+
+        if (layer < 0 || layer >= (int)m_vLayers.size()) return ChunkPointer_t();
+        layerSettings = m_vLayers[layer];
+
+        typename std::unordered_map<ChunkKey_t, typename ChunkList_t::iterator, ChunkKeyHasher>::iterator found = m_mChunkLookup.find(key);
+        if (found != m_mChunkLookup.end())
+        {
+            m_ullHits++;
+            m_lChunks.splice(m_lChunks.begin(), m_lChunks, found->second);
+            return *found->second;
+        }
+
+        m_ullMisses++;
+    }
+
+    //Generate outside of the lock so other lookups are not held up
+    std::shared_ptr<NoiseChunk_t> newChunk(new NoiseChunk_t());
+    newChunk->key = key;
+    newChunk->samplesPerSide = m_iChunkSize + 1;
+    GenerateChunk(*newChunk, layerSettings);
+
+    std::lock_guard<std::mutex> lock(m_mtxCache);
+
+    //Another caller may have generated the same chunk in the meantime
+    typename std::unordered_map<ChunkKey_t, typename ChunkList_t::iterator, ChunkKeyHasher>::iterator found = m_mChunkLookup.find(key);
+    if (found != m_mChunkLookup.end())
+    {
+        m_lChunks.splice(m_lChunks.begin(), m_lChunks, found->second);
+        return *found->second;
+    }
+
+    const size_t chunkBytes = ChunkBytes();
+    if (chunkBytes <= m_szByteBudget)
+    {
+        EvictToFit(chunkBytes);
+        m_lChunks.push_front(newChunk);
+        m_mChunkLookup[key] = m_lChunks.begin();
+        m_szBytesUsed += chunkBytes;
+    }
+
+    return newChunk;
+}
+
+
+
+/**
+* \brief Returns the chunk containing the world sample
+*/
+template<typename T>
+std::shared_ptr<const NoiseChunk_t> gchunkcache<T>::GetChunkAtWorld(T seed, int layer, int worldX, int worldY)
+{
+    return GetChunk(seed, layer, FloorDivideInt(worldX, m_iChunkSize), FloorDivideInt(worldY, m_iChunkSize));
+}
+
+
+
+/**
+* \brief Returns a single world sample through the chunk cache
+*/
+template<typename T>
+float gchunkcache<T>::SampleWorld(T seed, int layer, int worldX, int worldY)
+{
+    int chunkX = FloorDivideInt(worldX, m_iChunkSize);
+    int chunkY = FloorDivideInt(worldY, m_iChunkSize);
+    std::shared_ptr<const NoiseChunk_t> chunk = GetChunk(seed, layer, chunkX, chunkY);
+    if (!chunk) return 0.0f;
+    return chunk->At((int)((long long)worldX - (long long)chunkX * m_iChunkSize),
+        (int)((long long)worldY - (long long)chunkY * m_iChunkSize));
+}
+
+
+
+/**
+* \brief Makes sure every chunk within the radius around the center chunk is cached
+*/
+template<typename T>
+void gchunkcache<T>::Prefetch(T seed, int layer, int centerChunkX, int centerChunkY, int chunkRadius)
+{
+    for (int y = centerChunkY - chunkRadius; y <= centerChunkY + chunkRadius; y++)
+    {
+        for (int x = centerChunkX - chunkRadius; x <= centerChunkX + chunkRadius; x++)
+        {
+            GetChunk(seed, layer, x, y);
+        }
+    }
+}
+
+
+
+/**
+* \brief Sets the byte budget, evicting chunks if the cache is now over it
+*/
+template<typename T>
+void gchunkcache<T>::SetByteBudget(size_t byteBudget)
+{
+    std::lock_guard<std::mutex> lock(m_mtxCache);
+    m_szByteBudget = byteBudget;
+    EvictToFit(0);
+}
+
+
+
+/**
+* \brief Returns the cache counters
+*/
+template<typename T>
+ChunkCacheStatistics_t gchunkcache<T>::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mtxCache);
+    ChunkCacheStatistics_t statistics;
+    statistics.hits = m_ullHits;
+    statistics.misses = m_ullMisses;
+    statistics.evictions = m_ullEvictions;
+    statistics.bytesUsed = m_szBytesUsed;
+    statistics.byteBudget = m_szByteBudget;
+    statistics.chunkCount = m_lChunks.size();
+    return statistics;
+}
+
+
+
+/**
+* \brief Resets the hit, miss and eviction counters
+*/
+template<typename T>
+void gchunkcache<T>::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mtxCache);
+    m_ullHits = 0;
+    m_ullMisses = 0;
+    m_ullEvictions = 0;
+}
+
+
+
+/**
+* \brief Drops every cached chunk
+*/
+template<typename T>
+void gchunkcache<T>::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mtxCache);
+    m_mChunkLookup.clear();
+    m_lChunks.clear();
+    m_szBytesUsed = 0;
+}
+
+
+
+
+#endif
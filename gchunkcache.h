@@ -0,0 +1,182 @@
+/**
+ * @file gchunkcache.h
+ * @brief Header file for the streaming noise chunk generator and its LRU chunk cache
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCHUNKCACHE_H_INCLUDED
+#define GCHUNKCACHE_H_INCLUDED
+
+#include <stddef.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "grng.h"
+
+
+/**
+ * @brief Settings for one noise layer of the chunk generator. \n
+ * A layer is an octave sum of OffsetPerlinNoise2D, the same as PerlinOctaves2D builds.
+ */
+typedef struct ChunkLayerSettings {
+
+    int octaveAmount;
+    float noiseScale;
+    float noisePersistance;
+    float noiseLacunarity;
+    float roughness;
+
+    ///Remaining octave amplitude below which octaves stop being summed, zero sums them all
+    float amplitudeEpsilon;
+
+} ChunkLayer_t;
+
+
+
+/**
+ * @brief Identifies one generated chunk in the cache
+ */
+typedef struct ChunkKey {
+
+    unsigned long long seed;
+    int layer;
+    int chunkX;
+    int chunkY;
+
+    bool operator==(const ChunkKey& otherKey) const
+    {
+        return (seed == otherKey.seed && layer == otherKey.layer &&
+            chunkX == otherKey.chunkX && chunkY == otherKey.chunkY);
+    }
+
+} ChunkKey_t;
+
+
+
+/**
+ * @brief Hashes a chunk key for the cache lookup
+ */
+struct ChunkKeyHasher {
+    size_t operator()(const ChunkKey_t& key) const;
+};
+
+
+
+/**
+ * @brief A generated chunk. \n
+ * Holds (chunkSize + 1) * (chunkSize + 1) samples, row major by y. The last row and column
+ * are the first row and column of the neighbouring chunks so borders agree exactly.
+ */
+typedef struct NoiseChunk {
+
+    ChunkKey_t key;
+    int samplesPerSide;
+    std::vector<float> values;
+
+    inline float At(int x, int y) const
+    {
+        return values[(size_t)y * samplesPerSide + x];
+    }
+
+} NoiseChunk_t;
+
+
+
+/**
+ * @brief Counters for the chunk cache
+ */
+typedef struct ChunkCacheStatistics {
+
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long evictions;
+    size_t bytesUsed;
+    size_t byteBudget;
+    size_t chunkCount;
+
+} ChunkCacheStatistics_t;
+
+
+
+
+template<typename T>
+class gchunkcache
+{
+
+private:
+
+    typedef std::shared_ptr<const NoiseChunk_t> ChunkPointer_t;
+    typedef std::list<ChunkPointer_t> ChunkList_t;
+
+
+protected:
+
+    ///Samples along one chunk edge, not counting the shared border sample
+    int m_iChunkSize;
+
+    ///Noise layers that chunks can be generated for
+    std::vector<ChunkLayer_t> m_vLayers;
+
+    ///Chunks in use order, most recently used at the front
+    ChunkList_t m_lChunks;
+
+    ///Lookup from key to position in the use order
+    std::unordered_map<ChunkKey_t, typename ChunkList_t::iterator, ChunkKeyHasher> m_mChunkLookup;
+
+    ///Guards the cache containers and counters
+    std::mutex m_mtxCache;
+
+    ///Bytes the cache is allowed to hold
+    size_t m_szByteBudget;
+
+    ///Bytes the cache is holding
+    size_t m_szBytesUsed;
+
+    unsigned long long m_ullHits;
+    unsigned long long m_ullMisses;
+    unsigned long long m_ullEvictions;
+
+    size_t ChunkBytes() const;
+    void EvictToFit(size_t incomingBytes);
+    void GenerateChunk(NoiseChunk_t& chunk, const ChunkLayer_t& layer) const;
+
+
+public:
+
+    gchunkcache(int chunkSize, size_t byteBudget);
+    ~gchunkcache();
+
+    int AddLayer(const ChunkLayer_t& layer);
+
+    /**
+    * \brief Returns the amount of samples along one chunk edge, not counting the shared border
+    */
+    const inline int GetChunkSize()
+    {
+        return m_iChunkSize;
+    }
+
+    std::shared_ptr<const NoiseChunk_t> GetChunk(T seed, int layer, int chunkX, int chunkY);
+    std::shared_ptr<const NoiseChunk_t> GetChunkAtWorld(T seed, int layer, int worldX, int worldY);
+    float SampleWorld(T seed, int layer, int worldX, int worldY);
+    void Prefetch(T seed, int layer, int centerChunkX, int centerChunkY, int chunkRadius);
+
+    void SetByteBudget(size_t byteBudget);
+    ChunkCacheStatistics_t GetStatistics();
+    void ResetStatistics();
+    void Clear();
+};
+
+
+
+
+#include "gchunkcache.cpp"
+
+
+#endif // GCHUNKCACHE_H_INCLUDED
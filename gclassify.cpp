@@ -0,0 +1,222 @@
+/**
+ * @file gclassify.cpp
+ * @brief Source file for classifying noise samples into integer classes with threshold bands and stateless dithering
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCLASSIFY_CPP_INCLUDED
+#define GCLASSIFY_CPP_INCLUDED
+
+#include "gclassify.h"
+
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor, everything is class 0 until bands are added
+*/
+template<typename T>
+gclassifier<T>::gclassifier()
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = 0;
+    m_gdtSeed |= 6256256;
+    m_fDitherAmplitude = 0;
+    Clear();
+}
+
+
+
+/**
+* \brief Constructor, every sample below the lowest band takes belowClassId
+*/
+template<typename T>
+gclassifier<T>::gclassifier(const T newSeed, unsigned char belowClassId)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    m_fDitherAmplitude = 0;
+    Clear();
+    m_vClassIds[0] = belowClassId;
+    m_vAlternateClassIds[0] = belowClassId;
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gclassifier<T>::~gclassifier()
+{
+    m_gdtSeed = 0;
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Adds a threshold band, keeping the bands sorted by threshold
+*/
+template<typename T>
+void gclassifier<T>::AddBand(const ClassifyBand_t& band)
+{
+    const float chance = Clamp(band.alternateChance, 0.0f, 100.0f) / 100.0f;
+
+    size_t index = 1;
+    while (index < m_vThresholds.size() && m_vThresholds[index] <= band.threshold) index++;
+
+    m_vThresholds.insert(m_vThresholds.begin() + index, band.threshold);
+    m_vClassIds.insert(m_vClassIds.begin() + index, band.classId);
+    m_vAlternateClassIds.insert(m_vAlternateClassIds.begin() + index, band.alternateClassId);
+    m_vAlternateRolls.insert(m_vAlternateRolls.begin() + index, (unsigned int)(chance * (float)RollResolution));
+}
+
+
+
+/**
+* \brief Sets the class of samples below every band
+*/
+template<typename T>
+void gclassifier<T>::SetBelowClass(unsigned char classId)
+{
+    m_vClassIds[0] = classId;
+    m_vAlternateClassIds[0] = classId;
+}
+
+
+
+/**
+* \brief Sets the peak to peak size of the hashed offset added to samples before banding, 0 disables it. \n
+* Dithering breaks the hard contour lines a band edge leaves in smooth noise into a stable per cell scatter.
+*/
+template<typename T>
+void gclassifier<T>::SetDitherAmplitude(float ditherAmplitude)
+{
+    m_fDitherAmplitude = (ditherAmplitude < 0) ? -ditherAmplitude : ditherAmplitude;
+}
+
+
+
+/**
+* \brief Removes every band, leaving only the class below them
+*/
+template<typename T>
+void gclassifier<T>::Clear()
+{
+    unsigned char belowClassId = m_vClassIds.empty() ? 0 : m_vClassIds[0];
+
+    m_vThresholds.assign(1, 0.0f);
+    m_vClassIds.assign(1, belowClassId);
+    m_vAlternateClassIds.assign(1, belowClassId);
+    m_vAlternateRolls.assign(1, 0);
+}
+
+
+
+/**
+* \brief Classifies one sample belonging to the integer cell (cellX, cellY). \n
+* The same value, cell and seed always give the same class.
+*/
+template<typename T>
+unsigned char gclassifier<T>::Classify(float value, int cellX, int cellY) const
+{
+    unsigned char classId;
+    ClassifyRow(&value, cellX, cellY, 1, &classId);
+    return classId;
+}
+
+
+
+/**
+* \brief Classifies count samples of one row, the first belonging to cell (cellX, cellY) and the rest
+* to the cells following it along x. \n
+* The dither offset and the tie break roll come from the low and high halves of one coordinate hash,
+* so no generator state is touched and rows can be classified in any order or on any thread.
+*/
+template<typename T>
+void gclassifier<T>::ClassifyRow(const float* values, int cellX, int cellY, int count, unsigned char* out) const
+{
+    const int thresholdCount = (int)m_vThresholds.size();
+    const float* thresholds = &m_vThresholds[0];
+    const float ditherScale = m_fDitherAmplitude / (float)RollResolution;
+    const float ditherBias = m_fDitherAmplitude * 0.5f;
+    const unsigned int seed = (unsigned int)m_gdtSeed;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int hash = HashCoordinates2D<unsigned int>(seed, cellX + i, cellY);
+        float value = values[i] + (float)(hash & (RollResolution - 1)) * ditherScale - ditherBias;
+
+        int band = 0;
+        for (int b = 1; b < thresholdCount; b++) band += (value > thresholds[b]);
+
+        bool alternate = (hash >> 16) < m_vAlternateRolls[band];
+        out[i] = alternate ? m_vAlternateClassIds[band] : m_vClassIds[band];
+    }
+}
+
+
+
+/**
+* \brief Classifies a width by height field of samples, row major by y, the first belonging to cell (cellX, cellY)
+*/
+template<typename T>
+void gclassifier<T>::ClassifyValues(const float* values, int cellX, int cellY, int width, int height, unsigned char* out) const
+{
+    if (width <= 0 || height <= 0 || values == NULL || out == NULL) return;
+
+    for (int y = 0; y < height; y++)
+    {
+        ClassifyRow(values + (size_t)y * width, cellX, cellY + y, width, out + (size_t)y * width);
+    }
+}
+
+
+
+/**
+* \brief Samples source(x, y) over a width by height grid and classifies it, row major by y. \n
+* Samples are evaluated BlockSize at a time into a stack buffer and classified straight away, so no
+* float field is ever allocated. Sample (x, y) is taken at start + (x, y) * spacing and belongs to
+* cell (cellX + x, cellY + y). Source is any 2D noise functor, such as the gfractal adapters.
+*/
+template<typename T>
+template<typename Source>
+void gclassifier<T>::ClassifyGrid(const Source& source, float startX, float startY, float spacing,
+    int cellX, int cellY, int width, int height, unsigned char* out) const
+{
+    if (width <= 0 || height <= 0 || out == NULL) return;
+
+    float block[BlockSize];
+
+    for (int y = 0; y < height; y++)
+    {
+        const float sampleY = startY + (float)y * spacing;
+        unsigned char* row = out + (size_t)y * width;
+
+        for (int start = 0; start < width; start += BlockSize)
+        {
+            int blockCount = width - start;
+            if (blockCount > BlockSize) blockCount = BlockSize;
+
+            for (int i = 0; i < blockCount; i++)
+            {
+                block[i] = source(startX + (float)(start + i) * spacing, sampleY);
+            }
+
+            ClassifyRow(block, cellX + start, cellY + y, blockCount, row + start);
+        }
+    }
+}
+
+
+
+
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file gclassify.h
+ * @brief Header file for classifying noise samples into integer classes with threshold bands and stateless dithering
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCLASSIFY_H_INCLUDED
+#define GCLASSIFY_H_INCLUDED
+
+#include <stddef.h>
+#include <vector>
+#include "grng.h"
+#include "grandomAlgorithms.h"
+
+
+/**
+ * @brief One threshold band of a classifier. \n
+ * A sample above threshold, and not above the next higher band, takes classId, or alternateClassId
+ * when the cells hashed roll lands under alternateChance.
+ */
+typedef struct ClassifyBand {
+
+    float threshold;
+    unsigned char classId;
+    unsigned char alternateClassId;
+
+    ///Chance of the alternate class in percent, 0 - 100, the same scale ChanceRoll takes
+    float alternateChance;
+
+} ClassifyBand_t;
+
+
+
+
+template<typename T>
+class gclassifier
+{
+
+private:
+
+    ///Samples a fused grid classification evaluates before classifying them
+    static const int BlockSize = 64;
+
+    ///Resolution of the hashed dither and tie break rolls
+    static const unsigned int RollResolution = 65536;
+
+
+protected:
+
+    ///Seed the cell rolls are hashed with
+    T m_gdtSeed;
+
+    ///Band thresholds ascending, index 0 is the class below every band and never matched against
+    std::vector<float> m_vThresholds;
+    std::vector<unsigned char> m_vClassIds;
+    std::vector<unsigned char> m_vAlternateClassIds;
+
+    ///Alternate chances scaled to RollResolution
+    std::vector<unsigned int> m_vAlternateRolls;
+
+    ///Peak to peak size of the hashed offset added to each sample before the bands are compared
+    float m_fDitherAmplitude;
+
+
+public:
+
+    gclassifier();
+    gclassifier(const T newSeed, unsigned char belowClassId);
+    ~gclassifier();
+
+    /**
+    * \brief Sets this objects seed to the seed passed
+    */
+    inline void SetSeed(const T newSeed)
+    {
+        m_gdtSeed = newSeed;
+    }
+
+    /**
+    * \brief Returns this objects seed
+    */
+    const inline T GetSeed()
+    {
+        return m_gdtSeed;
+    }
+
+    /**
+    * \brief Returns the amount of bands, not counting the class below every band
+    */
+    const inline int GetBandCount() const
+    {
+        return (int)m_vThresholds.size() - 1;
+    }
+
+    void AddBand(const ClassifyBand_t& band);
+    void SetBelowClass(unsigned char classId);
+    void SetDitherAmplitude(float ditherAmplitude);
+    void Clear();
+
+    unsigned char Classify(float value, int cellX, int cellY) const;
+    void ClassifyRow(const float* values, int cellX, int cellY, int count, unsigned char* out) const;
+    void ClassifyValues(const float* values, int cellX, int cellY, int width, int height, unsigned char* out) const;
+
+    template<typename Source>
+    void ClassifyGrid(const Source& source, float startX, float startY, float spacing,
+        int cellX, int cellY, int width, int height, unsigned char* out) const;
+};
+
+
+
+
+#include "gclassify.cpp"
+
+
+#endif // GCLASSIFY_H_INCLUDED
@@ -0,0 +1,282 @@
+/**
+ * @file gcubesphere.cpp
+ * @brief Source file for generating planet surfaces from 3D noise sampled over the six faces of a cube sphere
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCUBESPHERE_CPP_INCLUDED
+#define GCUBESPHERE_CPP_INCLUDED
+
+#include "gcubesphere.h"
+
+
+#define CUBE_SPHERE_QUARTER_PI 0.78539816339744830962f
+
+
+/// <summary>
+/// Places face coordinates u, v on the cube in world axes, each face seen from outside with u right and v up
+/// </summary>
+static inline void CubeFaceToCube(CubeFace_t face, float u, float v, float* point) {
+    switch (face)
+    {
+    case Cube_Face_PositiveX:
+        point[0] = 1.0f; point[1] = v; point[2] = -u;
+        break;
+    case Cube_Face_NegativeX:
+        point[0] = -1.0f; point[1] = v; point[2] = u;
+        break;
+    case Cube_Face_PositiveY:
+        point[0] = u; point[1] = 1.0f; point[2] = -v;
+        break;
+    case Cube_Face_NegativeY:
+        point[0] = u; point[1] = -1.0f; point[2] = v;
+        break;
+    case Cube_Face_PositiveZ:
+        point[0] = u; point[1] = v; point[2] = 1.0f;
+        break;
+    default:
+        point[0] = -u; point[1] = v; point[2] = -1.0f;
+        break;
+    }
+}
+
+
+
+/// <summary>
+/// Moves a cube point onto the unit sphere. Only commutative sums and products of the world axis
+/// values are used, so the point comes out the same whichever face built it.
+/// </summary>
+static inline void CubeToSphere(CubeSphereProjection_t projection, float* point) {
+    const float x = point[0], y = point[1], z = point[2];
+
+    if (projection == Cube_Sphere_Spherified)
+    {
+        const float x2 = x * x, y2 = y * y, z2 = z * z;
+        point[0] = x * std::sqrt(1.0f - (y2 + z2) * 0.5f + (y2 * z2) / 3.0f);
+        point[1] = y * std::sqrt(1.0f - (x2 + z2) * 0.5f + (x2 * z2) / 3.0f);
+        point[2] = z * std::sqrt(1.0f - (x2 + y2) * 0.5f + (x2 * y2) / 3.0f);
+        return;
+    }
+
+    const float inverseLength = 1.0f / std::sqrt(x * x + y * y + z * z);
+    point[0] = x * inverseLength;
+    point[1] = y * inverseLength;
+    point[2] = z * inverseLength;
+}
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename BaseNoise>
+CubeSphere<BaseNoise>::CubeSphere(const BaseNoise& baseNoise, int resolution, CubeSphereProjection_t projection, float radius)
+    : m_udtBaseNoise(baseNoise)
+{
+    m_iResolution = (resolution < 1) ? 1 : resolution;
+    m_udtProjection = projection;
+    m_fRadius = radius;
+    BuildFaceCoordinates();
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename BaseNoise>
+CubeSphere<BaseNoise>::~CubeSphere()
+{
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Works out the face coordinate of every column and row, -1 at the first and 1 at the last. \n
+* Index i is (2i - (resolution - 1)) / (resolution - 1), so mirrored indices give exactly negated
+* coordinates, and the tangent warp keeps that by warping the magnitude and putting the sign back.
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::BuildFaceCoordinates()
+{
+    m_vFaceCoordinates.resize(m_iResolution);
+    const int last = m_iResolution - 1;
+
+    for (int i = 0; i < m_iResolution; i++)
+    {
+        float t = (last == 0) ? 0.0f : (float)(2 * i - last) / (float)last;
+        if (m_udtProjection == Cube_Sphere_Tangent && i != 0 && i != last)
+        {
+            t = std::copysign(std::tan(std::fabs(t) * CUBE_SPHERE_QUARTER_PI), t);
+        }
+        m_vFaceCoordinates[i] = t;
+    }
+}
+
+
+
+/**
+* \brief Sets the samples along each face edge, at least 1
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::SetResolution(int resolution)
+{
+    m_iResolution = (resolution < 1) ? 1 : resolution;
+    BuildFaceCoordinates();
+}
+
+
+
+/**
+* \brief Sets how the face grids are bent onto the sphere
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::SetProjection(CubeSphereProjection_t projection)
+{
+    m_udtProjection = projection;
+    BuildFaceCoordinates();
+}
+
+
+
+/**
+* \brief Writes the unit sphere direction of face sample (column, row) to point, 3 floats
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::FacePoint(CubeFace_t face, int column, int row, float* point) const
+{
+    CubeFaceToCube(face, m_vFaceCoordinates[column], m_vFaceCoordinates[row], point);
+    CubeToSphere(m_udtProjection, point);
+}
+
+
+
+/**
+* \brief Samples a width * height region of a face into out, rows outStride floats apart. \n
+* The sphere points are built BlockSize at a time into x, y and z arrays and handed to the array path
+* of the noise, then copied to their place in the region.
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::GenerateRegion(CubeFace_t face, int firstColumn, int firstRow, int width, int height,
+    float* out, size_t outStride) const
+{
+    float x[BlockSize], y[BlockSize], z[BlockSize], values[BlockSize];
+    const size_t count = (size_t)width * height;
+
+    for (size_t start = 0; start < count; start += BlockSize)
+    {
+        int blockCount = (int)((count - start < (size_t)BlockSize) ? count - start : (size_t)BlockSize);
+        int row = (int)(start / width);
+        int column = (int)(start - (size_t)row * width);
+        int i = 0;
+
+        for (i = 0; i < blockCount; i++)
+        {
+            float point[3];
+            FacePoint(face, firstColumn + column, firstRow + row, point);
+            x[i] = point[0] * m_fRadius;
+            y[i] = point[1] * m_fRadius;
+            z[i] = point[2] * m_fRadius;
+            if (++column == width)
+            {
+                column = 0;
+                row++;
+            }
+        }
+
+        m_udtBaseNoise.Evaluate(x, y, z, values, blockCount);
+
+        row = (int)(start / width);
+        column = (int)(start - (size_t)row * width);
+        for (i = 0; i < blockCount; i++)
+        {
+            out[(size_t)row * outStride + column] = values[i];
+            if (++column == width)
+            {
+                column = 0;
+                row++;
+            }
+        }
+    }
+}
+
+
+
+/**
+* \brief Samples one TileSize square tile of a face, clipped at the face edge. \n
+* out is the tile's first sample and outStride the floats between its rows, so a tile can be written
+* straight into a full face array or into a buffer of its own.
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::GenerateTile(CubeFace_t face, int tileColumn, int tileRow, float* out, size_t outStride) const
+{
+    const int firstColumn = tileColumn * TileSize;
+    const int firstRow = tileRow * TileSize;
+    if (out == NULL || firstColumn >= m_iResolution || firstRow >= m_iResolution) return;
+
+    const int width = (m_iResolution - firstColumn < TileSize) ? m_iResolution - firstColumn : TileSize;
+    const int height = (m_iResolution - firstRow < TileSize) ? m_iResolution - firstRow : TileSize;
+    GenerateRegion(face, firstColumn, firstRow, width, height, out, outStride);
+}
+
+
+
+/**
+* \brief Samples a whole face into out, resolution * resolution floats, see Generate
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::GenerateFace(CubeFace_t face, float* out, int threadCount) const
+{
+    float* faces[Cube_Face_Count] = { NULL, NULL, NULL, NULL, NULL, NULL };
+    faces[face] = out;
+    Generate(faces, threadCount);
+}
+
+
+
+/**
+* \brief Samples every face into faces, 6 arrays of resolution * resolution floats, NULL to skip a face. \n
+* The tiles of all the faces are split across threadCount threads, zero or less for one per hardware
+* thread. Ranges are handed out in samples so small tile counts still spread, and each thread takes
+* the whole tiles that start inside its range.
+*/
+template<typename BaseNoise>
+void CubeSphere<BaseNoise>::Generate(float* const* faces, int threadCount) const
+{
+    if (faces == NULL) return;
+
+    const int tilesPerEdge = GetTilesPerEdge();
+    const size_t tilesPerFace = (size_t)tilesPerEdge * tilesPerEdge;
+    const size_t tileSamples = (size_t)TileSize * TileSize;
+
+    ParallelForRange(tilesPerFace * Cube_Face_Count * tileSamples, threadCount, [&](size_t begin, size_t end)
+    {
+        const size_t firstTile = (begin + tileSamples - 1) / tileSamples;
+        const size_t endTile = (end + tileSamples - 1) / tileSamples;
+
+        for (size_t tile = firstTile; tile < endTile; tile++)
+        {
+            const int face = (int)(tile / tilesPerFace);
+            const int tileInFace = (int)(tile - (size_t)face * tilesPerFace);
+            const int tileRow = tileInFace / tilesPerEdge;
+            const int tileColumn = tileInFace - tileRow * tilesPerEdge;
+            if (faces[face] == NULL) continue;
+
+            float* out = faces[face] + (size_t)tileRow * TileSize * m_iResolution + (size_t)tileColumn * TileSize;
+            GenerateTile((CubeFace_t)face, tileColumn, tileRow, out, (size_t)m_iResolution);
+        }
+    });
+}
+
+
+
+
+#endif
@@ -0,0 +1,156 @@
+/**
+ * @file gcubesphere.h
+ * @brief Header file for generating planet surfaces from 3D noise sampled over the six faces of a cube sphere
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCUBESPHERE_H_INCLUDED
+#define GCUBESPHERE_H_INCLUDED
+
+#include <stddef.h>
+#include <cmath>
+#include <vector>
+#include "gbatch.h"
+#include "gparallel.h"
+
+
+/**
+ * @brief The six cube faces, each a resolution * resolution grid
+ */
+typedef enum CubeFaces {
+
+    Cube_Face_PositiveX,
+    Cube_Face_NegativeX,
+    Cube_Face_PositiveY,
+    Cube_Face_NegativeY,
+    Cube_Face_PositiveZ,
+    Cube_Face_NegativeZ,
+    Cube_Face_Count
+
+} CubeFace_t;
+
+
+
+/**
+ * @brief How the face grids are bent onto the sphere
+ */
+typedef enum CubeSphereProjections {
+
+    ///Cube points normalized, samples about 5 times denser at the face corners than the centres
+    Cube_Sphere_Normalized,
+
+    ///Face coordinates warped by tan(t * pi / 4) first, equal angles, within about 1.4 times
+    Cube_Sphere_Tangent,
+
+    ///x * sqrt(1 - y^2 / 2 - z^2 / 2 + y^2 z^2 / 3) and so on, closest to equal area, within about 1.35 times
+    Cube_Sphere_Spherified
+
+} CubeSphereProjection_t;
+
+
+
+
+/**
+ * @brief Samples a 3D batch noise, Fractal or a batch adapter, over a cube sphere. \n
+ * Face grids include their edges, and a point shared by two or three faces is built from the same
+ * world axis values on each, so neighbouring faces hold bit identical samples along their seams.
+ */
+template<typename BaseNoise>
+class CubeSphere
+{
+
+private:
+
+    ///Width and height of the square tiles the faces are generated in
+    static const int TileSize = 32;
+
+    ///Samples handed to the noise at a time
+    static const int BlockSize = 256;
+
+    void BuildFaceCoordinates();
+    void GenerateRegion(CubeFace_t face, int firstColumn, int firstRow, int width, int height, float* out, size_t outStride) const;
+
+
+protected:
+
+    ///The noise sampled at the sphere points
+    BaseNoise m_udtBaseNoise;
+
+    ///Samples along each face edge
+    int m_iResolution;
+
+    CubeSphereProjection_t m_udtProjection;
+
+    ///Radius of the sphere in noise coordinates
+    float m_fRadius;
+
+    ///Projected face coordinate of every column and row, shared by all six faces
+    std::vector<float> m_vFaceCoordinates;
+
+
+public:
+
+    CubeSphere(const BaseNoise& baseNoise, int resolution, CubeSphereProjection_t projection, float radius);
+    ~CubeSphere();
+
+    void SetResolution(int resolution);
+    void SetProjection(CubeSphereProjection_t projection);
+
+    /**
+    * \brief Returns the samples along each face edge
+    */
+    const inline int GetResolution() const
+    {
+        return m_iResolution;
+    }
+
+    /**
+    * \brief Returns how the face grids are bent onto the sphere
+    */
+    const inline CubeSphereProjection_t GetProjection() const
+    {
+        return m_udtProjection;
+    }
+
+    /**
+    * \brief Sets the radius of the sphere in noise coordinates
+    */
+    inline void SetRadius(float radius)
+    {
+        m_fRadius = radius;
+    }
+
+    /**
+    * \brief Returns the radius of the sphere in noise coordinates
+    */
+    const inline float GetRadius() const
+    {
+        return m_fRadius;
+    }
+
+    /**
+    * \brief Returns the tiles along each face edge
+    */
+    const inline int GetTilesPerEdge() const
+    {
+        return (m_iResolution + TileSize - 1) / TileSize;
+    }
+
+    void FacePoint(CubeFace_t face, int column, int row, float* point) const;
+
+    void GenerateTile(CubeFace_t face, int tileColumn, int tileRow, float* out, size_t outStride) const;
+    void GenerateFace(CubeFace_t face, float* out, int threadCount) const;
+    void Generate(float* const* faces, int threadCount) const;
+};
+
+
+
+
+#include "gcubesphere.cpp"
+
+
+#endif // GCUBESPHERE_H_INCLUDED
@@ -0,0 +1,284 @@
+/**
+ * @file gcurlnoise.cpp
+ * @brief Source file for divergence free curl noise used to advect particles
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCURLNOISE_CPP_INCLUDED
+#define GCURLNOISE_CPP_INCLUDED
+
+#include "gcurlnoise.h"
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gcurlnoise<T>::gcurlnoise()
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = 0;
+    m_gdtSeed |= 6256256;
+    m_udtSettings = DefaultCurlNoiseSettings();
+    BuildOctaves();
+}
+
+
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gcurlnoise<T>::gcurlnoise(const T newSeed)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    m_udtSettings = DefaultCurlNoiseSettings();
+    BuildOctaves();
+}
+
+
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gcurlnoise<T>::gcurlnoise(const T newSeed, const CurlNoiseSettings_t& settings)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    m_udtSettings = settings;
+    BuildOctaves();
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gcurlnoise<T>::~gcurlnoise()
+{
+    m_gdtSeed = 0;
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Precomputes the frequency, amplitude and hash seed of every octave. \n
+* Amplitudes are divided by their sum so each potential stays within the range of one octave.
+*/
+template<typename T>
+void gcurlnoise<T>::BuildOctaves()
+{
+    const int octaveAmount = MAX(m_udtSettings.octaveAmount, 1);
+    float frequency = m_udtSettings.frequency;
+    float amplitude = 1;
+    float amplitudeSum = 0;
+
+    m_vOctaves.resize(octaveAmount);
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        m_vOctaves[i].frequency = frequency;
+        m_vOctaves[i].amplitude = amplitude;
+        m_vOctaves[i].seed = HashCoordinates2D<unsigned int>((unsigned int)m_gdtSeed, i, 0x63757266);
+        amplitudeSum += amplitude;
+        frequency *= m_udtSettings.noiseLacunarity;
+        amplitude *= m_udtSettings.noisePersistance;
+    }
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        m_vOctaves[i].amplitude *= m_udtSettings.amplitude / amplitudeSum;
+    }
+}
+
+
+
+/**
+* \brief Sets this objects seed and rebuilds the octave seeds
+*/
+template<typename T>
+void gcurlnoise<T>::SetSeed(const T newSeed)
+{
+    m_gdtSeed = newSeed;
+    BuildOctaves();
+}
+
+
+
+/**
+* \brief Sets the octave settings
+*/
+template<typename T>
+void gcurlnoise<T>::SetSettings(const CurlNoiseSettings_t& settings)
+{
+    m_udtSettings = settings;
+    BuildOctaves();
+}
+
+
+
+/**
+* \brief Analytic gradients of the three potential fields at one point, in one pass. \n
+* The eight lattice corners are floored and hashed once. Each potential takes its gradient
+* from a different 5 bit slice of the same corner hash, bits 0 - 4, 5 - 9 and 10 - 14, so the
+* three fields are decorrelated without three separate lattice walks. Row p of gradients is the gradient of potential p.
+*/
+template<typename T>
+inline void gcurlnoise<T>::PotentialGradients(float x, float y, float z, unsigned int seed, float gradients[3][3]) const
+{
+    const int cellX = FastFloorToInt(x);
+    const int cellY = FastFloorToInt(y);
+    const int cellZ = FastFloorToInt(z);
+    x -= (float)cellX;
+    y -= (float)cellY;
+    z -= (float)cellZ;
+    const float u = FadeFloat(x);
+    const float v = FadeFloat(y);
+    const float w = FadeFloat(z);
+    const float du = FadeDerivativeFloat(x);
+    const float dv = FadeDerivativeFloat(y);
+    const float dw = FadeDerivativeFloat(z);
+
+    unsigned int hashes[8];
+    for (int i = 0; i < 8; i++)
+    {
+        hashes[i] = HashCoordinates3D<unsigned int>(seed, cellX + (i & 1), cellY + ((i >> 1) & 1), cellZ + ((i >> 2) & 1));
+    }
+
+    for (int p = 0; p < 3; p++)
+    {
+        float n[8];
+        float g[8][3];
+        for (int i = 0; i < 8; i++)
+        {
+            GradientVector3D((int)((hashes[i] >> (5 * p)) & 31), g[i]);
+            n[i] = g[i][0] * (x - (float)(i & 1)) + g[i][1] * (y - (float)((i >> 1) & 1)) + g[i][2] * (z - (float)((i >> 2) & 1));
+        }
+
+        float k1 = n[1] - n[0];
+        float k2 = n[2] - n[0];
+        float k3 = n[4] - n[0];
+        float k4 = n[0] - n[1] - n[2] + n[3];
+        float k5 = n[0] - n[2] - n[4] + n[6];
+        float k6 = n[0] - n[1] - n[4] + n[5];
+        float k7 = -n[0] + n[1] + n[2] - n[3] + n[4] - n[5] - n[6] + n[7];
+
+        float blended[3];
+        for (int axis = 0; axis < 3; axis++)
+        {
+            blended[axis] = CbFloatLerp(CbFloatLerp(CbFloatLerp(g[0][axis], g[1][axis], u), CbFloatLerp(g[2][axis], g[3][axis], u), v),
+                CbFloatLerp(CbFloatLerp(g[4][axis], g[5][axis], u), CbFloatLerp(g[6][axis], g[7][axis], u), v), w);
+        }
+
+        gradients[p][0] = du * (k1 + k4 * v + k6 * w + k7 * v * w) + blended[0];
+        gradients[p][1] = dv * (k2 + k5 * w + k4 * u + k7 * w * u) + blended[1];
+        gradients[p][2] = dw * (k3 + k6 * u + k5 * v + k7 * u * v) + blended[2];
+    }
+}
+
+
+
+/// <summary>
+/// Curl noise velocity at a point. \n
+/// The curl of the three potential fields, so the velocity field has no divergence and
+/// particles advected through it neither bunch up nor spread out.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+CurlVelocity_t gcurlnoise<T>::Evaluate(float x, float y, float z) const
+{
+    float potential[3][3] = { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } };
+
+    for (size_t octave = 0; octave < m_vOctaves.size(); octave++)
+    {
+        const CurlOctave_t& current = m_vOctaves[octave];
+        float gradients[3][3];
+        PotentialGradients(x * current.frequency, y * current.frequency, z * current.frequency, current.seed, gradients);
+
+        const float scale = current.amplitude * current.frequency;
+        for (int p = 0; p < 3; p++)
+        {
+            potential[p][0] += gradients[p][0] * scale;
+            potential[p][1] += gradients[p][1] * scale;
+            potential[p][2] += gradients[p][2] * scale;
+        }
+    }
+
+    CurlVelocity_t velocity;
+    velocity.x = potential[2][1] - potential[1][2];
+    velocity.y = potential[0][2] - potential[2][0];
+    velocity.z = potential[1][0] - potential[0][1];
+    return velocity;
+}
+
+
+
+/**
+* \brief Curl noise velocities for arrays of particle positions, on the calling thread
+*/
+template<typename T>
+void gcurlnoise<T>::Evaluate(const float* x, const float* y, const float* z, float* velocityX, float* velocityY, float* velocityZ,
+    size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        CurlVelocity_t velocity = Evaluate(x[i], y[i], z[i]);
+        velocityX[i] = velocity.x;
+        velocityY[i] = velocity.y;
+        velocityZ[i] = velocity.z;
+    }
+}
+
+
+
+/**
+* \brief Curl noise velocities for arrays of particle positions, split across threads. \n
+* A threadCount of zero or less uses every hardware thread.
+*/
+template<typename T>
+void gcurlnoise<T>::Evaluate(const float* x, const float* y, const float* z, float* velocityX, float* velocityY, float* velocityZ,
+    size_t count, int threadCount) const
+{
+    const gcurlnoise<T>* self = this;
+    ParallelForRange(count, threadCount, [=](size_t begin, size_t end) {
+        self->Evaluate(x + begin, y + begin, z + begin, velocityX + begin, velocityY + begin, velocityZ + begin, end - begin);
+    });
+}
+
+
+
+/**
+* \brief Moves every particle one explicit euler step along the curl noise field
+*/
+template<typename T>
+void gcurlnoise<T>::Advect(float* x, float* y, float* z, size_t count, float deltaTime, int threadCount) const
+{
+    const gcurlnoise<T>* self = this;
+    ParallelForRange(count, threadCount, [=](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            CurlVelocity_t velocity = self->Evaluate(x[i], y[i], z[i]);
+            x[i] += velocity.x * deltaTime;
+            y[i] += velocity.y * deltaTime;
+            z[i] += velocity.z * deltaTime;
+        }
+    });
+}
+
+
+
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file gcurlnoise.h
+ * @brief Header file for divergence free curl noise used to advect particles
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GCURLNOISE_H_INCLUDED
+#define GCURLNOISE_H_INCLUDED
+
+#include <stddef.h>
+#include <vector>
+#include "grng.h"
+#include "grandomAlgorithms.h"
+#include "gparallel.h"
+
+
+/**
+ * @brief Settings for the octave sum of the three potential fields
+ */
+typedef struct CurlNoiseSettings {
+
+    ///Frequency of the first octave
+    float frequency;
+    int octaveAmount;
+    float noisePersistance;
+    float noiseLacunarity;
+
+    ///Scales the returned velocity
+    float amplitude;
+
+} CurlNoiseSettings_t;
+
+
+
+/**
+ * @brief Velocity of one curl noise sample
+ */
+typedef struct CurlVelocity {
+
+    float x;
+    float y;
+    float z;
+
+} CurlVelocity_t;
+
+
+
+/**
+ * @brief One octave of curl noise, one frequency, amplitude and seed
+ */
+typedef struct CurlOctave {
+
+    float frequency;
+    float amplitude;
+    unsigned int seed;
+
+} CurlOctave_t;
+
+
+
+/**
+ * @brief Returns settings for a single octave of unit frequency and amplitude
+ */
+inline CurlNoiseSettings_t DefaultCurlNoiseSettings()
+{
+    CurlNoiseSettings_t settings;
+    settings.frequency = 1.0f;
+    settings.octaveAmount = 1;
+    settings.noisePersistance = 0.5f;
+    settings.noiseLacunarity = 2.0f;
+    settings.amplitude = 1.0f;
+    return settings;
+}
+
+
+
+
+template<typename T>
+class gcurlnoise
+{
+
+private:
+
+    void BuildOctaves();
+    inline void PotentialGradients(float x, float y, float z, unsigned int seed, float gradients[3][3]) const;
+
+
+protected:
+
+    ///Seed every potential field is hashed from
+    T m_gdtSeed;
+
+    CurlNoiseSettings_t m_udtSettings;
+
+    ///Frequency, amplitude and hash seed of every octave
+    std::vector<CurlOctave_t> m_vOctaves;
+
+
+public:
+
+    gcurlnoise();
+    gcurlnoise(const T newSeed);
+    gcurlnoise(const T newSeed, const CurlNoiseSettings_t& settings);
+    ~gcurlnoise();
+
+    void SetSeed(const T newSeed);
+    void SetSettings(const CurlNoiseSettings_t& settings);
+
+    /**
+    * \brief Returns this objects seed
+    */
+    const inline T GetSeed()
+    {
+        return m_gdtSeed;
+    }
+
+    CurlVelocity_t Evaluate(float x, float y, float z) const;
+
+    void Evaluate(const float* x, const float* y, const float* z, float* velocityX, float* velocityY, float* velocityZ,
+        size_t count) const;
+    void Evaluate(const float* x, const float* y, const float* z, float* velocityX, float* velocityY, float* velocityZ,
+        size_t count, int threadCount) const;
+
+    void Advect(float* x, float* y, float* z, size_t count, float deltaTime, int threadCount) const;
+};
+
+
+
+
+#include "gcurlnoise.cpp"
+
+
+#endif // GCURLNOISE_H_INCLUDED
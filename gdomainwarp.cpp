@@ -0,0 +1,281 @@
+/**
+ * @file gdomainwarp.cpp
+ * @brief Source file for domain warping fused into one block resident pass over warp and base noise
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GDOMAINWARP_CPP_INCLUDED
+#define GDOMAINWARP_CPP_INCLUDED
+
+#include "gdomainwarp.h"
+
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename WarpNoise, typename BaseNoise>
+DomainWarp<WarpNoise, BaseNoise>::DomainWarp(const WarpNoise& warpNoise, const BaseNoise& baseNoise,
+    const DomainWarpSettings_t& settings) : m_udtWarpNoise(warpNoise), m_udtBaseNoise(baseNoise)
+{
+    SetSettings(settings);
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename WarpNoise, typename BaseNoise>
+DomainWarp<WarpNoise, BaseNoise>::~DomainWarp()
+{
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Sets the warp settings, at least one iteration
+*/
+template<typename WarpNoise, typename BaseNoise>
+void DomainWarp<WarpNoise, BaseNoise>::SetSettings(const DomainWarpSettings_t& settings)
+{
+    m_udtSettings = settings;
+    if (m_udtSettings.iterations < 1) m_udtSettings.iterations = 1;
+}
+
+
+
+/**
+* \brief Offset warp of up to BlockSize points, q = p + strength * (warp(p'), warp(p' + channel offset)). \n
+* Each iteration samples the warp noise at the point the last one produced, so two iterations give
+* base(p + s * w(p + s * w(p))). The coordinates stay in block arrays between the warp and base calls
+* instead of a full pass per stage.
+*/
+template<typename WarpNoise, typename BaseNoise>
+void DomainWarp<WarpNoise, BaseNoise>::WarpBlock(const float* x, const float* y, float* warpedX, float* warpedY, int count,
+    std::false_type) const
+{
+    float sampleX[BlockSize], sampleY[BlockSize];
+    float displacementX[BlockSize], displacementY[BlockSize];
+    const float strength = m_udtSettings.strength;
+    const float frequency = m_udtSettings.warpFrequency;
+    const float channelX = m_udtSettings.channelOffsetX;
+    const float channelY = m_udtSettings.channelOffsetY;
+    int i = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        warpedX[i] = x[i];
+        warpedY[i] = y[i];
+    }
+
+    for (int iteration = 0; iteration < m_udtSettings.iterations; iteration++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            sampleX[i] = warpedX[i] * frequency;
+            sampleY[i] = warpedY[i] * frequency;
+        }
+        m_udtWarpNoise.Evaluate(sampleX, sampleY, displacementX, count);
+
+        for (i = 0; i < count; i++)
+        {
+            sampleX[i] += channelX;
+            sampleY[i] += channelY;
+        }
+        m_udtWarpNoise.Evaluate(sampleX, sampleY, displacementY, count);
+
+        for (i = 0; i < count; i++)
+        {
+            warpedX[i] = x[i] + strength * displacementX[i];
+            warpedY[i] = y[i] + strength * displacementY[i];
+        }
+    }
+}
+
+
+
+/**
+* \brief Flow warp of up to BlockSize points, moved along the contour lines of the warp noise. \n
+* Each iteration steps strength / iterations along the warp gradient turned a quarter turn, (dy, -dx), so
+* points slide along the noise instead of towards its peaks. The analytic derivative gives that field from
+* one warp evaluation per iteration where the offset warp needs two.
+*/
+template<typename WarpNoise, typename BaseNoise>
+void DomainWarp<WarpNoise, BaseNoise>::WarpBlock(const float* x, const float* y, float* warpedX, float* warpedY, int count,
+    std::true_type) const
+{
+    float sampleX[BlockSize], sampleY[BlockSize];
+    float value[BlockSize], slopeX[BlockSize], slopeY[BlockSize];
+    const float step = m_udtSettings.strength / (float)m_udtSettings.iterations;
+    const float frequency = m_udtSettings.warpFrequency;
+    int i = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        warpedX[i] = x[i];
+        warpedY[i] = y[i];
+    }
+
+    for (int iteration = 0; iteration < m_udtSettings.iterations; iteration++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            sampleX[i] = warpedX[i] * frequency;
+            sampleY[i] = warpedY[i] * frequency;
+        }
+        m_udtWarpNoise.EvaluateDerivative(sampleX, sampleY, value, slopeX, slopeY, count);
+
+        for (i = 0; i < count; i++)
+        {
+            warpedX[i] += step * slopeY[i];
+            warpedY[i] -= step * slopeX[i];
+        }
+    }
+}
+
+
+
+/**
+* \brief Warps and samples count points, BlockSize at a time
+*/
+template<typename WarpNoise, typename BaseNoise>
+template<typename Flow>
+void DomainWarp<WarpNoise, BaseNoise>::EvaluatePoints(const float* x, const float* y, float* out, size_t count) const
+{
+    float warpedX[BlockSize], warpedY[BlockSize];
+
+    for (size_t start = 0; start < count; start += BlockSize)
+    {
+        int blockCount = (int)((count - start < (size_t)BlockSize) ? count - start : (size_t)BlockSize);
+        WarpBlock(x + start, y + start, warpedX, warpedY, blockCount, Flow());
+        m_udtBaseNoise.Evaluate(warpedX, warpedY, out + start, blockCount);
+    }
+}
+
+
+
+/**
+* \brief Warps and samples a width * height grid, sample (column, row) at (startX + column * spacing, startY + row * spacing). \n
+* The samples are split across threadCount threads, zero or less for one per hardware thread, and each
+* thread generates its grid coordinates a block at a time so no coordinate arrays are stored.
+*/
+template<typename WarpNoise, typename BaseNoise>
+template<typename Flow>
+void DomainWarp<WarpNoise, BaseNoise>::EvaluateGridPoints(float startX, float startY, float spacing, int width, int height,
+    float* out, int threadCount) const
+{
+    if (out == NULL || width <= 0 || height <= 0) return;
+
+    ParallelForRange((size_t)width * height, threadCount, [&](size_t begin, size_t end)
+    {
+        float x[BlockSize], y[BlockSize], warpedX[BlockSize], warpedY[BlockSize];
+
+        for (size_t start = begin; start < end; start += BlockSize)
+        {
+            int blockCount = (int)((end - start < (size_t)BlockSize) ? end - start : (size_t)BlockSize);
+            size_t row = start / width;
+            size_t column = start - row * width;
+
+            for (int i = 0; i < blockCount; i++)
+            {
+                x[i] = startX + (float)column * spacing;
+                y[i] = startY + (float)row * spacing;
+                if (++column == (size_t)width)
+                {
+                    column = 0;
+                    row++;
+                }
+            }
+
+            WarpBlock(x, y, warpedX, warpedY, blockCount, Flow());
+            m_udtBaseNoise.Evaluate(warpedX, warpedY, out + start, blockCount);
+        }
+    });
+}
+
+
+
+/**
+* \brief Returns the base noise at the offset warped point
+*/
+template<typename WarpNoise, typename BaseNoise>
+float DomainWarp<WarpNoise, BaseNoise>::Evaluate(float x, float y) const
+{
+    float result = 0;
+    EvaluatePoints<std::false_type>(&x, &y, &result, 1);
+    return result;
+}
+
+
+
+/**
+* \brief Offset warps arrays of points and samples the base noise at them
+*/
+template<typename WarpNoise, typename BaseNoise>
+void DomainWarp<WarpNoise, BaseNoise>::Evaluate(const float* x, const float* y, float* out, size_t count) const
+{
+    EvaluatePoints<std::false_type>(x, y, out, count);
+}
+
+
+
+/**
+* \brief Offset warps a grid and samples the base noise over it, see EvaluateGridPoints
+*/
+template<typename WarpNoise, typename BaseNoise>
+void DomainWarp<WarpNoise, BaseNoise>::EvaluateGrid(float startX, float startY, float spacing, int width, int height,
+    float* out, int threadCount) const
+{
+    EvaluateGridPoints<std::false_type>(startX, startY, spacing, width, height, out, threadCount);
+}
+
+
+
+/**
+* \brief Returns the base noise at the flow warped point
+*/
+template<typename WarpNoise, typename BaseNoise>
+float DomainWarp<WarpNoise, BaseNoise>::EvaluateFlow(float x, float y) const
+{
+    float result = 0;
+    EvaluatePoints<std::true_type>(&x, &y, &result, 1);
+    return result;
+}
+
+
+
+/**
+* \brief Flow warps arrays of points and samples the base noise at them
+*/
+template<typename WarpNoise, typename BaseNoise>
+void DomainWarp<WarpNoise, BaseNoise>::EvaluateFlow(const float* x, const float* y, float* out, size_t count) const
+{
+    EvaluatePoints<std::true_type>(x, y, out, count);
+}
+
+
+
+/**
+* \brief Flow warps a grid and samples the base noise over it, see EvaluateGridPoints
+*/
+template<typename WarpNoise, typename BaseNoise>
+void DomainWarp<WarpNoise, BaseNoise>::EvaluateFlowGrid(float startX, float startY, float spacing, int width, int height,
+    float* out, int threadCount) const
+{
+    EvaluateGridPoints<std::true_type>(startX, startY, spacing, width, height, out, threadCount);
+}
+
+
+
+
+#endif
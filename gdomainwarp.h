@@ -0,0 +1,124 @@
+/**
+ * @file gdomainwarp.h
+ * @brief Header file for domain warping fused into one block resident pass over warp and base noise
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GDOMAINWARP_H_INCLUDED
+#define GDOMAINWARP_H_INCLUDED
+
+#include <stddef.h>
+#include <type_traits>
+#include "gbatch.h"
+#include "gparallel.h"
+
+
+/**
+ * @brief Settings for a domain warp
+ */
+typedef struct DomainWarpSettings {
+
+    ///Distance, in base noise coordinates, a warp noise value of 1 moves a point
+    float strength;
+
+    ///Times the warp is applied, each one sampling the warp noise at the point the last one produced
+    int iterations;
+
+    ///Frequency the warp noise is sampled at, relative to the point
+    float warpFrequency;
+
+    ///Offset between the x and y warp samples so the two displacements are not the same noise
+    float channelOffsetX;
+    float channelOffsetY;
+
+} DomainWarpSettings_t;
+
+
+
+/**
+ * @brief Returns a single iteration warp of unit strength and frequency
+ */
+inline DomainWarpSettings_t DefaultDomainWarpSettings()
+{
+    DomainWarpSettings_t settings;
+    settings.strength = 1.0f;
+    settings.iterations = 1;
+    settings.warpFrequency = 1.0f;
+    settings.channelOffsetX = 5.2f;
+    settings.channelOffsetY = 1.3f;
+    return settings;
+}
+
+
+
+
+/**
+ * @brief Domain warp over any two batch noises, the base sampled at points the warp noise displaced. \n
+ * Both take the Evaluate(x, y, out, count) form of the batch adapters and Fractal, and the flow warp
+ * also needs EvaluateDerivative(x, y, value, dx, dy, count).
+ */
+template<typename WarpNoise, typename BaseNoise>
+class DomainWarp
+{
+
+private:
+
+    ///Samples whose warped coordinates are carried through every stage at a time
+    static const int BlockSize = 256;
+
+    void WarpBlock(const float* x, const float* y, float* warpedX, float* warpedY, int count, std::false_type) const;
+    void WarpBlock(const float* x, const float* y, float* warpedX, float* warpedY, int count, std::true_type) const;
+
+    template<typename Flow>
+    void EvaluatePoints(const float* x, const float* y, float* out, size_t count) const;
+
+    template<typename Flow>
+    void EvaluateGridPoints(float startX, float startY, float spacing, int width, int height, float* out, int threadCount) const;
+
+
+protected:
+
+    ///The noise the points are displaced by
+    WarpNoise m_udtWarpNoise;
+
+    ///The noise sampled at the displaced points
+    BaseNoise m_udtBaseNoise;
+
+    DomainWarpSettings_t m_udtSettings;
+
+
+public:
+
+    DomainWarp(const WarpNoise& warpNoise, const BaseNoise& baseNoise, const DomainWarpSettings_t& settings);
+    ~DomainWarp();
+
+    void SetSettings(const DomainWarpSettings_t& settings);
+
+    /**
+    * \brief Returns the settings the warp was built with
+    */
+    const inline DomainWarpSettings_t& GetSettings() const
+    {
+        return m_udtSettings;
+    }
+
+    float Evaluate(float x, float y) const;
+    void Evaluate(const float* x, const float* y, float* out, size_t count) const;
+    void EvaluateGrid(float startX, float startY, float spacing, int width, int height, float* out, int threadCount) const;
+
+    float EvaluateFlow(float x, float y) const;
+    void EvaluateFlow(const float* x, const float* y, float* out, size_t count) const;
+    void EvaluateFlowGrid(float startX, float startY, float spacing, int width, int height, float* out, int threadCount) const;
+};
+
+
+
+
+#include "gdomainwarp.cpp"
+
+
+#endif // GDOMAINWARP_H_INCLUDED
@@ -0,0 +1,65 @@
+/**
+ * @file gfixed.h
+ * @brief Header file for the 16.16 fixed point number the noise kernels can run on
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GFIXED_H_INCLUDED
+#define GFIXED_H_INCLUDED
+
+
+/**
+ * @brief Signed 16.16 fixed point number. \n
+ * Every operation is plain integer math, so results are identical on every compiler and
+ * platform, which lockstep simulations need. The range is about -32768 to 32767.
+ */
+typedef struct Fixed16 {
+
+    ///The value times 65536
+    int raw;
+
+    Fixed16() : raw(0) {}
+    explicit Fixed16(int value) : raw(value * 65536) {}
+    explicit Fixed16(float value) : raw((int)(value * 65536.0f + ((value < 0) ? -0.5f : 0.5f))) {}
+    explicit Fixed16(double value) : raw((int)(value * 65536.0 + ((value < 0) ? -0.5 : 0.5))) {}
+
+    static inline Fixed16 FromRaw(int rawValue)
+    {
+        Fixed16 result;
+        result.raw = rawValue;
+        return result;
+    }
+
+    inline float ToFloat() const { return (float)raw * (1.0f / 65536.0f); }
+    inline double ToDouble() const { return (double)raw * (1.0 / 65536.0); }
+
+    ///Largest whole number not above the value
+    inline int Floor() const { return raw >> 16; }
+
+    inline Fixed16 operator+(const Fixed16& other) const { return FromRaw(raw + other.raw); }
+    inline Fixed16 operator-(const Fixed16& other) const { return FromRaw(raw - other.raw); }
+    inline Fixed16 operator-() const { return FromRaw(-raw); }
+    inline Fixed16 operator*(const Fixed16& other) const { return FromRaw((int)(((long long)raw * other.raw) >> 16)); }
+    inline Fixed16 operator/(const Fixed16& other) const { return FromRaw((int)(((long long)raw * 65536) / other.raw)); }
+
+    inline Fixed16& operator+=(const Fixed16& other) { raw += other.raw; return *this; }
+    inline Fixed16& operator-=(const Fixed16& other) { raw -= other.raw; return *this; }
+    inline Fixed16& operator*=(const Fixed16& other) { *this = *this * other; return *this; }
+
+    inline bool operator==(const Fixed16& other) const { return raw == other.raw; }
+    inline bool operator!=(const Fixed16& other) const { return raw != other.raw; }
+    inline bool operator<(const Fixed16& other) const { return raw < other.raw; }
+    inline bool operator>(const Fixed16& other) const { return raw > other.raw; }
+    inline bool operator<=(const Fixed16& other) const { return raw <= other.raw; }
+    inline bool operator>=(const Fixed16& other) const { return raw >= other.raw; }
+
+} Fixed16_t;
+
+
+
+
+#endif // GFIXED_H_INCLUDED
@@ -0,0 +1,756 @@
+/**
+ * @file gfractal.cpp
+ * @brief Source file for the compile time fractal (octave sum) template over any base noise
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GFRACTAL_CPP_INCLUDED
+#define GFRACTAL_CPP_INCLUDED
+
+#include "gfractal.h"
+
+
+#pragma region STATIC_MATH
+
+/// <summary>
+/// Scales one axis of a large world position, origin + local, into an octave's lattice. \n
+/// origin * frequency is split into a whole cell and a fraction in double, and the small local part is
+/// added to the fraction in float, so the precision left for the fraction does not depend on the local offset.
+/// </summary>
+static inline void ScaleLargeCoordinate(long long origin, float local, float frequency, float offset, long long& cell, float& fraction) {
+    double scaled = (double)origin * frequency + offset;
+    double whole = std::floor(scaled);
+    cell = (long long)whole;
+    fraction = (float)(scaled - whole) + local * frequency;
+}
+
+#pragma endregion
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor, precomputes the octave frequencies, amplitudes and offsets
+* \param baseNoise The noise every octave samples
+* \param settings The fractal settings
+* \param seed Seed for the per octave coordinate offsets
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+Fractal<BaseNoise, Variant>::Fractal(const BaseNoise& baseNoise, const FractalSettings_t& settings, unsigned long long seed)
+    : m_udtBaseNoise(baseNoise)
+{
+    m_udtSettings = settings;
+    if(m_udtSettings.octaveAmount < 1) m_udtSettings.octaveAmount = 1;
+    if(m_udtSettings.noisePersistance <= 0) m_udtSettings.noisePersistance = 0.001f;
+    if(m_udtSettings.noiseLacunarity < 0.01f) m_udtSettings.noiseLacunarity = 0.01f;
+    if(m_udtSettings.frequency == 0) m_udtSettings.frequency = 1;
+
+    const int octaveAmount = m_udtSettings.octaveAmount;
+    m_vAllOctaves.resize(octaveAmount);
+    m_fSampleSpacing = 0;
+    m_fAmplitudeEpsilon = 0;
+
+    grng<unsigned long long> offsetRng(seed);
+    float amplitude = 1;
+    float frequency = m_udtSettings.frequency;
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        m_vAllOctaves[i].frequency = frequency;
+        m_vAllOctaves[i].amplitude = amplitude;
+        m_vAllOctaves[i].offsetX = offsetRng.RangeFloat(-m_udtSettings.roughness, m_udtSettings.roughness);
+        m_vAllOctaves[i].offsetY = offsetRng.RangeFloat(-m_udtSettings.roughness, m_udtSettings.roughness);
+        m_vAllOctaves[i].offsetZ = offsetRng.RangeFloat(-m_udtSettings.roughness, m_udtSettings.roughness);
+        amplitude *= m_udtSettings.noisePersistance;
+        frequency *= m_udtSettings.noiseLacunarity;
+    }
+
+    SelectOctaves();
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+Fractal<BaseNoise, Variant>::~Fractal()
+{
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Rebuilds the tables the evaluation loops read from the octaves that survive culling. \n
+* Without a sample spacing every octave is kept, apart from those cut by the amplitude epsilon.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::SelectOctaves()
+{
+    const int octaveAmount = (int)m_vAllOctaves.size();
+    std::vector<float> cyclesPerSample(octaveAmount);
+    std::vector<float> amplitudes(octaveAmount);
+    std::vector<int> keptOctaves(octaveAmount);
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        cyclesPerSample[i] = m_vAllOctaves[i].frequency * m_fSampleSpacing;
+        amplitudes[i] = m_vAllOctaves[i].amplitude;
+    }
+
+    const int keptAmount = SelectVisibleOctaves(&cyclesPerSample[0], &amplitudes[0], octaveAmount, m_fAmplitudeEpsilon, &keptOctaves[0]);
+
+    m_vOctaveFrequencies.resize(keptAmount);
+    m_vOctaveAmplitudes.resize(keptAmount);
+    m_vOctaveOffsetsX.resize(keptAmount);
+    m_vOctaveOffsetsY.resize(keptAmount);
+    m_vOctaveOffsetsZ.resize(keptAmount);
+    m_fAmplitudeSum = 0;
+
+    for (int k = 0; k < keptAmount; k++)
+    {
+        const FractalOctave_t& octave = m_vAllOctaves[keptOctaves[k]];
+        m_vOctaveFrequencies[k] = octave.frequency;
+        m_vOctaveAmplitudes[k] = octave.amplitude;
+        m_vOctaveOffsetsX[k] = octave.offsetX;
+        m_vOctaveOffsetsY[k] = octave.offsetY;
+        m_vOctaveOffsetsZ[k] = octave.offsetZ;
+        m_fAmplitudeSum += octave.amplitude;
+    }
+}
+
+
+
+/**
+* \brief Culls octaves for a sampling density. \n
+* Octaves with more than half a cycle between neighbouring samples are skipped, they would only alias,
+* and summing stops once the amplitude still to come is below amplitudeEpsilon. Distant LOD chunks
+* with a wide sample spacing then evaluate far fewer octaves.
+* \param sampleSpacing Distance between neighbouring samples, zero keeps every octave
+* \param amplitudeEpsilon Remaining amplitude to stop at, zero sums to the last octave
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::SetCulling(float sampleSpacing, float amplitudeEpsilon)
+{
+    m_fSampleSpacing = std::fabs(sampleSpacing);
+    m_fAmplitudeEpsilon = amplitudeEpsilon;
+    SelectOctaves();
+}
+
+
+
+/**
+* \brief Returns the range the fractal can reach, worked out from the amplitudes of the octaves being
+* summed rather than from sampled data. Assumes the base noise stays within -1 to 1.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::GetValueBounds(float& minValue, float& maxValue) const
+{
+    switch (Variant)
+    {
+    case Fractal_Variant_Ridged:
+    {
+        //The signal is (offset - |noise|)^2 times a weight of at most 1
+        float highest = MAX(std::fabs(m_udtSettings.ridgeOffset), std::fabs(m_udtSettings.ridgeOffset - 1.0f));
+        float lowest = (m_udtSettings.ridgeOffset >= 0 && m_udtSettings.ridgeOffset <= 1) ? 0.0f :
+            MIN(std::fabs(m_udtSettings.ridgeOffset), std::fabs(m_udtSettings.ridgeOffset - 1.0f));
+        minValue = 0;
+        maxValue = highest * highest * m_fAmplitudeSum;
+        if (m_vOctaveAmplitudes.size() > 0) minValue = lowest * lowest * m_vOctaveAmplitudes[0];
+        break;
+    }
+
+    case Fractal_Variant_Turbulence:
+        minValue = 0;
+        maxValue = m_fAmplitudeSum;
+        break;
+
+    default:
+        minValue = -m_fAmplitudeSum;
+        maxValue = m_fAmplitudeSum;
+        break;
+    }
+}
+
+
+
+/**
+* \brief Maps a value of this fractal into 0 - 1 using GetValueBounds, a single pass replacement for a min/max scan
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+float Fractal<BaseNoise, Variant>::NormalizeValue(float value) const
+{
+    float minValue, maxValue;
+    GetValueBounds(minValue, maxValue);
+    return InverseLerpClamped(minValue, maxValue, value);
+}
+
+
+
+/**
+* \brief Shapes one octave's noise for the billow and turbulence variants. \n
+* The variant is a template parameter so the switch folds away.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+inline float Fractal<BaseNoise, Variant>::ShapeOctave(float noise)
+{
+    switch (Variant)
+    {
+    case Fractal_Variant_Billow:
+        return 2.0f * std::fabs(noise) - 1.0f;
+
+    case Fractal_Variant_Turbulence:
+        return std::fabs(noise);
+
+    default:
+        return noise;
+    }
+}
+
+
+
+/**
+* \brief One ridged multifractal octave, (ridgeOffset - |noise|)^2 times the weight from the octave before. \n
+* Returns the octave's signal and leaves the weight for the next octave, signal * ridgeGain clamped to 0 - 1.
+* Start the weight at 1 for the first octave.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+inline float Fractal<BaseNoise, Variant>::RidgeOctave(float noise, const FractalSettings_t& settings, float& weight)
+{
+    float signal = settings.ridgeOffset - std::fabs(noise);
+    signal *= signal * weight;
+    weight = Clamp01(signal * settings.ridgeGain);
+    return signal;
+}
+
+
+
+/**
+* \brief Evaluates the fractal at a 2D point
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+float Fractal<BaseNoise, Variant>::Evaluate(float x, float y) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float noiseValue = 0;
+
+    if (Variant == Fractal_Variant_Ridged)
+    {
+        float weight = 1;
+        for (int i = 0; i < octaveAmount; i++)
+        {
+            float frequency = m_vOctaveFrequencies[i];
+            float noise = m_udtBaseNoise(x * frequency + m_vOctaveOffsetsX[i], y * frequency + m_vOctaveOffsetsY[i]);
+            noiseValue += RidgeOctave(noise, m_udtSettings, weight) * m_vOctaveAmplitudes[i];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < octaveAmount; i++)
+        {
+            float frequency = m_vOctaveFrequencies[i];
+            float noise = m_udtBaseNoise(x * frequency + m_vOctaveOffsetsX[i], y * frequency + m_vOctaveOffsetsY[i]);
+            noiseValue += ShapeOctave(noise) * m_vOctaveAmplitudes[i];
+        }
+    }
+
+    return noiseValue;
+}
+
+
+
+/**
+* \brief Evaluates the fractal at a 3D point
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+float Fractal<BaseNoise, Variant>::Evaluate(float x, float y, float z) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float noiseValue = 0;
+
+    if (Variant == Fractal_Variant_Ridged)
+    {
+        float weight = 1;
+        for (int i = 0; i < octaveAmount; i++)
+        {
+            float frequency = m_vOctaveFrequencies[i];
+            float noise = m_udtBaseNoise(x * frequency + m_vOctaveOffsetsX[i],
+                y * frequency + m_vOctaveOffsetsY[i], z * frequency + m_vOctaveOffsetsZ[i]);
+            noiseValue += RidgeOctave(noise, m_udtSettings, weight) * m_vOctaveAmplitudes[i];
+        }
+    }
+    else
+    {
+        for (int i = 0; i < octaveAmount; i++)
+        {
+            float frequency = m_vOctaveFrequencies[i];
+            float noise = m_udtBaseNoise(x * frequency + m_vOctaveOffsetsX[i],
+                y * frequency + m_vOctaveOffsetsY[i], z * frequency + m_vOctaveOffsetsZ[i]);
+            noiseValue += ShapeOctave(noise) * m_vOctaveAmplitudes[i];
+        }
+    }
+
+    return noiseValue;
+}
+
+
+
+/**
+* \brief Evaluates the fractal for a batch of 2D points stored as separate x and y arrays. \n
+* Works block by block with the octave loop outside the sample loop, so the coordinate
+* transform and accumulation run over contiguous arrays the compiler can vectorize.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::Evaluate(const float* x, const float* y, float* out, size_t count) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float octaveX[BatchBlockSize];
+    float octaveY[BatchBlockSize];
+    float noise[BatchBlockSize];
+    float weight[BatchBlockSize];
+
+    for (size_t start = 0; start < count; start += BatchBlockSize)
+    {
+        const int blockCount = (int)((count - start < (size_t)BatchBlockSize) ? count - start : BatchBlockSize);
+        const float* blockX = x + start;
+        const float* blockY = y + start;
+        float* blockOut = out + start;
+
+        for (int k = 0; k < blockCount; k++)
+        {
+            blockOut[k] = 0;
+            weight[k] = 1;
+        }
+
+        for (int i = 0; i < octaveAmount; i++)
+        {
+            const float frequency = m_vOctaveFrequencies[i];
+            const float amplitude = m_vOctaveAmplitudes[i];
+            const float offsetX = m_vOctaveOffsetsX[i];
+            const float offsetY = m_vOctaveOffsetsY[i];
+
+            for (int k = 0; k < blockCount; k++)
+            {
+                octaveX[k] = blockX[k] * frequency + offsetX;
+                octaveY[k] = blockY[k] * frequency + offsetY;
+            }
+
+            for (int k = 0; k < blockCount; k++)
+            {
+                noise[k] = m_udtBaseNoise(octaveX[k], octaveY[k]);
+            }
+
+            if (Variant == Fractal_Variant_Ridged)
+            {
+                for (int k = 0; k < blockCount; k++)
+                {
+                    blockOut[k] += RidgeOctave(noise[k], m_udtSettings, weight[k]) * amplitude;
+                }
+            }
+            else
+            {
+                for (int k = 0; k < blockCount; k++)
+                {
+                    blockOut[k] += ShapeOctave(noise[k]) * amplitude;
+                }
+            }
+        }
+    }
+}
+
+
+
+/**
+* \brief Evaluates the fractal for a batch of 3D points stored as separate x, y and z arrays
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::Evaluate(const float* x, const float* y, const float* z, float* out, size_t count) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float octaveX[BatchBlockSize];
+    float octaveY[BatchBlockSize];
+    float octaveZ[BatchBlockSize];
+    float noise[BatchBlockSize];
+    float weight[BatchBlockSize];
+
+    for (size_t start = 0; start < count; start += BatchBlockSize)
+    {
+        const int blockCount = (int)((count - start < (size_t)BatchBlockSize) ? count - start : BatchBlockSize);
+        const float* blockX = x + start;
+        const float* blockY = y + start;
+        const float* blockZ = z + start;
+        float* blockOut = out + start;
+
+        for (int k = 0; k < blockCount; k++)
+        {
+            blockOut[k] = 0;
+            weight[k] = 1;
+        }
+
+        for (int i = 0; i < octaveAmount; i++)
+        {
+            const float frequency = m_vOctaveFrequencies[i];
+            const float amplitude = m_vOctaveAmplitudes[i];
+            const float offsetX = m_vOctaveOffsetsX[i];
+            const float offsetY = m_vOctaveOffsetsY[i];
+            const float offsetZ = m_vOctaveOffsetsZ[i];
+
+            for (int k = 0; k < blockCount; k++)
+            {
+                octaveX[k] = blockX[k] * frequency + offsetX;
+                octaveY[k] = blockY[k] * frequency + offsetY;
+                octaveZ[k] = blockZ[k] * frequency + offsetZ;
+            }
+
+            for (int k = 0; k < blockCount; k++)
+            {
+                noise[k] = m_udtBaseNoise(octaveX[k], octaveY[k], octaveZ[k]);
+            }
+
+            if (Variant == Fractal_Variant_Ridged)
+            {
+                for (int k = 0; k < blockCount; k++)
+                {
+                    blockOut[k] += RidgeOctave(noise[k], m_udtSettings, weight[k]) * amplitude;
+                }
+            }
+            else
+            {
+                for (int k = 0; k < blockCount; k++)
+                {
+                    blockOut[k] += ShapeOctave(noise[k]) * amplitude;
+                }
+            }
+        }
+    }
+}
+
+
+
+/**
+* \brief Evaluates a width * height grid of the fractal straight into 8 bit, 16 bit or half float samples,
+* row major by y. \n
+* Each row goes through the batch path into one row of floats and is quantized against GetValueBounds
+* before the next, so the whole grid is one pass and only ever holds a row of floats.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::EvaluateGridQuantized(float startX, float startY, float spacing, int width, int height,
+    QuantizedFormat_t format, void* out) const
+{
+    if (width <= 0 || height <= 0 || out == NULL) return;
+
+    float minValue, maxValue;
+    GetValueBounds(minValue, maxValue);
+
+    std::vector<float> rowX(width), rowY(width), rowValues(width);
+    for (int x = 0; x < width; x++) rowX[x] = startX + (float)x * spacing;
+
+    const size_t rowBytes = (size_t)width * QuantizedFormatBytes(format);
+    unsigned char* target = (unsigned char*)out;
+
+    for (int y = 0; y < height; y++)
+    {
+        const float sampleY = startY + (float)y * spacing;
+        for (int x = 0; x < width; x++) rowY[x] = sampleY;
+
+        Evaluate(&rowX[0], &rowY[0], &rowValues[0], (size_t)width);
+        QuantizeSamples(&rowValues[0], (size_t)width, minValue, maxValue, format, target + rowBytes * y);
+    }
+}
+
+
+
+/**
+* \brief Evaluates a width * height grid of the fractal straight into class ids, row major by y. \n
+* Samples go through the batch path BatchBlockSize at a time into stack buffers and are classified
+* before the next block, so no float field is ever allocated. Sample (x, y) is taken at
+* start + (x, y) * spacing and its dither and tie break are hashed from cell (cellX + x, cellY + y).
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+template<typename T>
+void Fractal<BaseNoise, Variant>::EvaluateGridClassified(float startX, float startY, float spacing, int cellX, int cellY,
+    int width, int height, const gclassifier<T>& classifier, unsigned char* out) const
+{
+    if (width <= 0 || height <= 0 || out == NULL) return;
+
+    float blockX[BatchBlockSize], blockY[BatchBlockSize], blockValues[BatchBlockSize];
+
+    for (int y = 0; y < height; y++)
+    {
+        const float sampleY = startY + (float)y * spacing;
+        unsigned char* row = out + (size_t)y * width;
+
+        for (int start = 0; start < width; start += BatchBlockSize)
+        {
+            int blockCount = width - start;
+            if (blockCount > BatchBlockSize) blockCount = BatchBlockSize;
+
+            for (int i = 0; i < blockCount; i++)
+            {
+                blockX[i] = startX + (float)(start + i) * spacing;
+                blockY[i] = sampleY;
+            }
+
+            Evaluate(blockX, blockY, blockValues, (size_t)blockCount);
+            classifier.ClassifyRow(blockValues, cellX + start, cellY + y, blockCount, row + start);
+        }
+    }
+}
+
+
+
+/**
+* \brief Evaluates the fractal at the 2D world position origin + local. \n
+* The base noise must provide Large(cellX, cellY, x, y), such as GrngPerlin2D. The result is seamless
+* across origin shifts and keeps its detail far from zero, up to the precision double gives origin * frequency.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+float Fractal<BaseNoise, Variant>::EvaluateLarge(long long originX, long long originY, float localX, float localY) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float noiseValue = 0;
+    float weight = 1;
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        long long cellX, cellY;
+        float fractionX, fractionY;
+        ScaleLargeCoordinate(originX, localX, m_vOctaveFrequencies[i], m_vOctaveOffsetsX[i], cellX, fractionX);
+        ScaleLargeCoordinate(originY, localY, m_vOctaveFrequencies[i], m_vOctaveOffsetsY[i], cellY, fractionY);
+        float noise = m_udtBaseNoise.Large(cellX, cellY, fractionX, fractionY);
+
+        if (Variant == Fractal_Variant_Ridged)
+        {
+            noiseValue += RidgeOctave(noise, m_udtSettings, weight) * m_vOctaveAmplitudes[i];
+        }
+        else
+        {
+            noiseValue += ShapeOctave(noise) * m_vOctaveAmplitudes[i];
+        }
+    }
+
+    return noiseValue;
+}
+
+
+
+/**
+* \brief Evaluates the fractal at the 3D world position origin + local. \n
+* The base noise must provide Large(cellX, cellY, cellZ, x, y, z), such as GrngPerlin3D.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+float Fractal<BaseNoise, Variant>::EvaluateLarge(long long originX, long long originY, long long originZ,
+    float localX, float localY, float localZ) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float noiseValue = 0;
+    float weight = 1;
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        long long cellX, cellY, cellZ;
+        float fractionX, fractionY, fractionZ;
+        ScaleLargeCoordinate(originX, localX, m_vOctaveFrequencies[i], m_vOctaveOffsetsX[i], cellX, fractionX);
+        ScaleLargeCoordinate(originY, localY, m_vOctaveFrequencies[i], m_vOctaveOffsetsY[i], cellY, fractionY);
+        ScaleLargeCoordinate(originZ, localZ, m_vOctaveFrequencies[i], m_vOctaveOffsetsZ[i], cellZ, fractionZ);
+        float noise = m_udtBaseNoise.Large(cellX, cellY, cellZ, fractionX, fractionY, fractionZ);
+
+        if (Variant == Fractal_Variant_Ridged)
+        {
+            noiseValue += RidgeOctave(noise, m_udtSettings, weight) * m_vOctaveAmplitudes[i];
+        }
+        else
+        {
+            noiseValue += ShapeOctave(noise) * m_vOctaveAmplitudes[i];
+        }
+    }
+
+    return noiseValue;
+}
+
+
+
+/**
+* \brief Adds one octave's value and gradient to the running sums. \n
+* The base noise gradient is scaled by the octave frequency (chain rule) and then pushed
+* through the variant's shaping, including the previous octave weight of the ridged variant.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+inline void Fractal<BaseNoise, Variant>::AccumulateDerivative(float noise, const float* noiseGradient, int dimensions, int octave,
+    float& value, float* gradient, float& weight, float* weightGradient) const
+{
+    const float frequency = m_vOctaveFrequencies[octave];
+    const float amplitude = m_vOctaveAmplitudes[octave];
+    const float noiseSign = (noise < 0) ? -1.0f : 1.0f;
+    int axis = 0;
+
+    switch (Variant)
+    {
+    case Fractal_Variant_Ridged:
+    {
+        float ridge = m_udtSettings.ridgeOffset - std::fabs(noise);
+        float signal = ridge * ridge * weight;
+        float signalGradient[3];
+
+        for (axis = 0; axis < dimensions; axis++)
+        {
+            float ridgeGradient = -noiseSign * frequency * noiseGradient[axis];
+            signalGradient[axis] = 2.0f * ridge * ridgeGradient * weight + ridge * ridge * weightGradient[axis];
+            gradient[axis] += signalGradient[axis] * amplitude;
+        }
+
+        float nextWeight = signal * m_udtSettings.ridgeGain;
+        bool clamped = (nextWeight <= 0.0f || nextWeight >= 1.0f);
+        for (axis = 0; axis < dimensions; axis++)
+        {
+            weightGradient[axis] = clamped ? 0.0f : signalGradient[axis] * m_udtSettings.ridgeGain;
+        }
+
+        weight = Clamp01(nextWeight);
+        value += signal * amplitude;
+        break;
+    }
+
+    case Fractal_Variant_Billow:
+        value += (2.0f * std::fabs(noise) - 1.0f) * amplitude;
+        for (axis = 0; axis < dimensions; axis++) gradient[axis] += 2.0f * noiseSign * frequency * noiseGradient[axis] * amplitude;
+        break;
+
+    case Fractal_Variant_Turbulence:
+        value += std::fabs(noise) * amplitude;
+        for (axis = 0; axis < dimensions; axis++) gradient[axis] += noiseSign * frequency * noiseGradient[axis] * amplitude;
+        break;
+
+    default:
+        value += noise * amplitude;
+        for (axis = 0; axis < dimensions; axis++) gradient[axis] += frequency * noiseGradient[axis] * amplitude;
+        break;
+    }
+}
+
+
+
+/**
+* \brief Evaluates the fractal and its analytic gradient at a 2D point. \n
+* The base noise must provide Derivative(x, y), such as GrngPerlin2D.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+NoiseDerivative2D_t Fractal<BaseNoise, Variant>::EvaluateDerivative(float x, float y) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float value = 0;
+    float gradient[3] = { 0, 0, 0 };
+    float weight = 1;
+    float weightGradient[3] = { 0, 0, 0 };
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        float frequency = m_vOctaveFrequencies[i];
+        NoiseDerivative2D_t sample = m_udtBaseNoise.Derivative(x * frequency + m_vOctaveOffsetsX[i], y * frequency + m_vOctaveOffsetsY[i]);
+        float noiseGradient[2] = { sample.dx, sample.dy };
+        AccumulateDerivative(sample.value, noiseGradient, 2, i, value, gradient, weight, weightGradient);
+    }
+
+    NoiseDerivative2D_t result = { value, gradient[0], gradient[1] };
+    return result;
+}
+
+
+
+/**
+* \brief Evaluates the fractal and its analytic gradient at a 3D point. \n
+* The base noise must provide Derivative(x, y, z), such as GrngPerlin3D or GrngImprovedNoise.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+NoiseDerivative3D_t Fractal<BaseNoise, Variant>::EvaluateDerivative(float x, float y, float z) const
+{
+    const int octaveAmount = (int)m_vOctaveAmplitudes.size();
+    float value = 0;
+    float gradient[3] = { 0, 0, 0 };
+    float weight = 1;
+    float weightGradient[3] = { 0, 0, 0 };
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        float frequency = m_vOctaveFrequencies[i];
+        NoiseDerivative3D_t sample = m_udtBaseNoise.Derivative(x * frequency + m_vOctaveOffsetsX[i],
+            y * frequency + m_vOctaveOffsetsY[i], z * frequency + m_vOctaveOffsetsZ[i]);
+        float noiseGradient[3] = { sample.dx, sample.dy, sample.dz };
+        AccumulateDerivative(sample.value, noiseGradient, 3, i, value, gradient, weight, weightGradient);
+    }
+
+    NoiseDerivative3D_t result = { value, gradient[0], gradient[1], gradient[2] };
+    return result;
+}
+
+
+
+/**
+* \brief Evaluates the fractal and its gradient for a batch of 2D points into separate value and gradient arrays
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::EvaluateDerivative(const float* x, const float* y, float* value, float* dx, float* dy, size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        NoiseDerivative2D_t sample = EvaluateDerivative(x[i], y[i]);
+        value[i] = sample.value;
+        dx[i] = sample.dx;
+        dy[i] = sample.dy;
+    }
+}
+
+
+
+/**
+* \brief Evaluates the fractal and its gradient for a batch of 3D points into separate value and gradient arrays
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void Fractal<BaseNoise, Variant>::EvaluateDerivative(const float* x, const float* y, const float* z, float* value,
+    float* dx, float* dy, float* dz, size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        NoiseDerivative3D_t sample = EvaluateDerivative(x[i], y[i], z[i]);
+        value[i] = sample.value;
+        dx[i] = sample.dx;
+        dy[i] = sample.dy;
+        dz[i] = sample.dz;
+    }
+}
+
+
+
+/**
+* \brief Wraps a copy of this fractal in a type erased 2D noise function
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+NoiseFunction2D_t Fractal<BaseNoise, Variant>::ToFunction2D() const
+{
+    Fractal<BaseNoise, Variant> fractalCopy(*this);
+    return [fractalCopy](float x, float y) { return fractalCopy.Evaluate(x, y); };
+}
+
+
+
+/**
+* \brief Wraps a copy of this fractal in a type erased 3D noise function
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+NoiseFunction3D_t Fractal<BaseNoise, Variant>::ToFunction3D() const
+{
+    Fractal<BaseNoise, Variant> fractalCopy(*this);
+    return [fractalCopy](float x, float y, float z) { return fractalCopy.Evaluate(x, y, z); };
+}
+
+
+
+
+#endif
@@ -0,0 +1,304 @@
+/**
+ * @file gfractal.h
+ * @brief Header file for the compile time fractal (octave sum) template over any base noise
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GFRACTAL_H_INCLUDED
+#define GFRACTAL_H_INCLUDED
+
+#include <stddef.h>
+#include <functional>
+#include <vector>
+#include "grng.h"
+#include "gcellular.h"
+#include "gquantize.h"
+#include "gclassify.h"
+
+
+/**
+ * @brief Ways a fractal can combine its octaves
+ */
+typedef enum FractalVariants {
+
+    Fractal_Variant_FBm,
+    Fractal_Variant_Ridged,
+    Fractal_Variant_Billow,
+    Fractal_Variant_Turbulence
+
+} FractalVariant_t;
+
+
+
+/**
+ * @brief Settings shared by every fractal variant
+ */
+typedef struct FractalSettings {
+
+    ///Amount of octaves to sum
+    int octaveAmount;
+
+    ///Amplitude multiplier from one octave to the next
+    float noisePersistance;
+
+    ///Frequency multiplier from one octave to the next
+    float noiseLacunarity;
+
+    ///Frequency of the first octave
+    float frequency;
+
+    ///Range of the random per octave coordinate offsets, same as PerlinOctaves2D
+    float roughness;
+
+    ///Ridged multifractal: value the absolute noise is subtracted from
+    float ridgeOffset;
+
+    ///Ridged multifractal: how strongly one octave weights the next
+    float ridgeGain;
+
+} FractalSettings_t;
+
+
+
+/**
+ * @brief Frequency, amplitude and coordinate offsets of one octave
+ */
+typedef struct FractalOctave {
+
+    float frequency;
+    float amplitude;
+    float offsetX;
+    float offsetY;
+    float offsetZ;
+
+} FractalOctave_t;
+
+
+
+/**
+ * @brief Returns fractal settings with the usual defaults
+ */
+inline FractalSettings_t DefaultFractalSettings()
+{
+    FractalSettings_t settings;
+    settings.octaveAmount = 6;
+    settings.noisePersistance = 0.5f;
+    settings.noiseLacunarity = 2.0f;
+    settings.frequency = 1.0f;
+    settings.roughness = 1000.0f;
+    settings.ridgeOffset = 1.0f;
+    settings.ridgeGain = 2.0f;
+    return settings;
+}
+
+
+
+///Type erased two dimensional noise, for when the fractal type can not be known at compile time
+typedef std::function<float(float, float)> NoiseFunction2D_t;
+
+///Type erased three dimensional noise, for when the fractal type can not be known at compile time
+typedef std::function<float(float, float, float)> NoiseFunction3D_t;
+
+
+
+#pragma region BASE_NOISE_ADAPTERS
+
+/**
+ * @brief Base noise adapter for grng::Perlin2D
+ */
+template<typename T>
+struct GrngPerlin2D {
+    grng<T>* generator;
+    inline float operator()(float x, float y) const { return generator->Perlin2D(x, y); }
+    inline NoiseDerivative2D_t Derivative(float x, float y) const { return generator->Perlin2DDerivative(x, y); }
+    inline float Large(long long cellX, long long cellY, float x, float y) const { return generator->Perlin2DLarge(cellX, cellY, x, y); }
+};
+
+
+
+/**
+ * @brief Base noise adapter for grng::Perlin3D
+ */
+template<typename T>
+struct GrngPerlin3D {
+    grng<T>* generator;
+    inline float operator()(float x, float y, float z) const { return generator->Perlin3D(x, y, z); }
+    inline NoiseDerivative3D_t Derivative(float x, float y, float z) const { return generator->Perlin3DDerivative(x, y, z); }
+    inline float Large(long long cellX, long long cellY, long long cellZ, float x, float y, float z) const {
+        return generator->Perlin3DLarge(cellX, cellY, cellZ, x, y, z);
+    }
+};
+
+
+
+/**
+ * @brief Base noise adapter for Ken Perlin's improved noise in double precision. \n
+ * grng::ImprovedNoise adds NextDouble to the coordinates on every call, so this samples the same field
+ * through PerlinKernel3D<double> without the offsets, coherent and safe to share between threads.
+ */
+template<typename T>
+struct GrngImprovedNoise {
+    grng<T>* generator;
+    inline float operator()(float x, float y) const { return (float)generator->template PerlinKernel3D<double>(x, y, 0.01); }
+    inline float operator()(float x, float y, float z) const { return (float)generator->template PerlinKernel3D<double>(x, y, z); }
+    inline NoiseDerivative3D_t Derivative(float x, float y, float z) const {
+        NoiseDerivative3DDouble_t sample = generator->ImprovedNoiseDerivative(x, y, z);
+        NoiseDerivative3D_t result = { (float)sample.value, (float)sample.dx, (float)sample.dy, (float)sample.dz };
+        return result;
+    }
+};
+
+
+
+/**
+ * @brief Base noise adapter for value noise through grng::SmoothValueNoise2D/3D. \n
+ * grng::ValueNoise2D/3D draw NextInt on every call, so this samples the hashed lattice instead,
+ * coherent and safe to share between threads.
+ */
+template<typename T>
+struct GrngValueNoise {
+    grng<T>* generator;
+    int seedValue;
+    inline float operator()(float x, float y) const { return generator->SmoothValueNoise2D(x, y, seedValue); }
+    inline float operator()(float x, float y, float z) const { return generator->SmoothValueNoise3D(x, y, z, seedValue); }
+};
+
+
+
+/**
+ * @brief Base noise adapter for Voronoi noise through gcellular::Evaluate2D/3D. \n
+ * grng::Voronoi2D/3D add NextDouble to the coordinates on every call, so this takes the nearest feature
+ * point from the stateless cellular search instead and shapes it like Voronoi2D with CellularVoronoiValue.
+ */
+template<typename T>
+struct GrngVoronoi {
+    gcellular<T>* cellular;
+    bool useDistance;
+    float displacement;
+    inline float operator()(float x, float y) const {
+        return CellularVoronoiValue(cellular->Evaluate2D(x, y), useDistance, displacement);
+    }
+    inline float operator()(float x, float y, float z) const {
+        return CellularVoronoiValue(cellular->Evaluate3D(x, y, z), useDistance, displacement);
+    }
+};
+
+#pragma endregion
+
+
+
+
+template<typename BaseNoise, FractalVariant_t Variant>
+class Fractal
+{
+
+private:
+
+    ///Samples handled per block in the batch paths
+    static const int BatchBlockSize = 64;
+
+    void SelectOctaves();
+    inline void AccumulateDerivative(float noise, const float* noiseGradient, int dimensions, int octave,
+        float& value, float* gradient, float& weight, float* weightGradient) const;
+
+
+protected:
+
+    ///The noise every octave samples
+    BaseNoise m_udtBaseNoise;
+
+    ///Settings the octave tables were built from
+    FractalSettings_t m_udtSettings;
+
+    ///Every octave the settings describe, whether it is culled or not
+    std::vector<FractalOctave_t> m_vAllOctaves;
+
+    ///Spacing between samples the octaves are culled for, zero disables Nyquist culling
+    float m_fSampleSpacing;
+
+    ///Remaining amplitude below which octaves stop being summed
+    float m_fAmplitudeEpsilon;
+
+    ///Precomputed frequency, amplitude and coordinate offsets of the octaves being summed
+    std::vector<float> m_vOctaveFrequencies;
+    std::vector<float> m_vOctaveAmplitudes;
+    std::vector<float> m_vOctaveOffsetsX;
+    std::vector<float> m_vOctaveOffsetsY;
+    std::vector<float> m_vOctaveOffsetsZ;
+
+    ///Sum of the amplitudes of the octaves being summed
+    float m_fAmplitudeSum;
+
+
+public:
+
+    Fractal(const BaseNoise& baseNoise, const FractalSettings_t& settings, unsigned long long seed);
+    ~Fractal();
+
+    /**
+    * \brief Returns the sum of the octave amplitudes, useful for normalizing the output
+    */
+    const inline float GetAmplitudeSum()
+    {
+        return m_fAmplitudeSum;
+    }
+
+    /**
+    * \brief Returns the amount of octaves being summed
+    */
+    const inline int GetOctaveAmount()
+    {
+        return (int)m_vOctaveAmplitudes.size();
+    }
+
+    static inline float ShapeOctave(float noise);
+    static inline float RidgeOctave(float noise, const FractalSettings_t& settings, float& weight);
+
+    /**
+    * \brief Returns every octave the settings describe, culled or not
+    */
+    const inline std::vector<FractalOctave_t>& GetOctaves() const
+    {
+        return m_vAllOctaves;
+    }
+
+    void SetCulling(float sampleSpacing, float amplitudeEpsilon);
+    void GetValueBounds(float& minValue, float& maxValue) const;
+    float NormalizeValue(float value) const;
+
+    float Evaluate(float x, float y) const;
+    float Evaluate(float x, float y, float z) const;
+    void Evaluate(const float* x, const float* y, float* out, size_t count) const;
+    void Evaluate(const float* x, const float* y, const float* z, float* out, size_t count) const;
+
+    void EvaluateGridQuantized(float startX, float startY, float spacing, int width, int height,
+        QuantizedFormat_t format, void* out) const;
+
+    template<typename T>
+    void EvaluateGridClassified(float startX, float startY, float spacing, int cellX, int cellY,
+        int width, int height, const gclassifier<T>& classifier, unsigned char* out) const;
+
+    float EvaluateLarge(long long originX, long long originY, float localX, float localY) const;
+    float EvaluateLarge(long long originX, long long originY, long long originZ, float localX, float localY, float localZ) const;
+
+    NoiseDerivative2D_t EvaluateDerivative(float x, float y) const;
+    NoiseDerivative3D_t EvaluateDerivative(float x, float y, float z) const;
+    void EvaluateDerivative(const float* x, const float* y, float* value, float* dx, float* dy, size_t count) const;
+    void EvaluateDerivative(const float* x, const float* y, const float* z, float* value,
+        float* dx, float* dy, float* dz, size_t count) const;
+
+    NoiseFunction2D_t ToFunction2D() const;
+    NoiseFunction3D_t ToFunction3D() const;
+};
+
+
+
+
+#include "gfractal.cpp"
+
+
+#endif // GFRACTAL_H_INCLUDED
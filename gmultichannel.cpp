@@ -0,0 +1,197 @@
+/**
+ * @file gmultichannel.cpp
+ * @brief Source file for evaluating several decorrelated gradient noise channels in one lattice pass
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GMULTICHANNEL_CPP_INCLUDED
+#define GMULTICHANNEL_CPP_INCLUDED
+
+#include "gmultichannel.h"
+
+
+/// <summary>
+/// 16 evenly spaced gradient directions, length sqrt(2) so the noise spans about -1 to 1 like Perlin2D
+/// </summary>
+static const float MultiChannelGradients[16][2] = {
+    { 1.41421356f, 0.00000000f }, { 1.30656296f, 0.54119610f }, { 1.00000000f, 1.00000000f }, { 0.54119610f, 1.30656296f },
+    { 0.00000000f, 1.41421356f }, { -0.54119610f, 1.30656296f }, { -1.00000000f, 1.00000000f }, { -1.30656296f, 0.54119610f },
+    { -1.41421356f, 0.00000000f }, { -1.30656296f, -0.54119610f }, { -1.00000000f, -1.00000000f }, { -0.54119610f, -1.30656296f },
+    { 0.00000000f, -1.41421356f }, { 0.54119610f, -1.30656296f }, { 1.00000000f, -1.00000000f }, { 1.30656296f, -0.54119610f }
+};
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gmultichannel<T>::gmultichannel()
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = 0;
+    m_gdtSeed |= 6256256;
+    m_iChannelCount = 4;
+}
+
+
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gmultichannel<T>::gmultichannel(const T newSeed, int channelCount)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    SetChannelCount(channelCount);
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gmultichannel<T>::~gmultichannel()
+{
+    m_gdtSeed = 0;
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Sets the amount of channels computed per sample, clamped to 1 - MaxChannels
+*/
+template<typename T>
+void gmultichannel<T>::SetChannelCount(int channelCount)
+{
+    if (channelCount < 1) channelCount = 1;
+    if (channelCount > MaxChannels) channelCount = MaxChannels;
+    m_iChannelCount = channelCount;
+}
+
+
+
+/**
+* \brief Evaluates every channel for up to BlockSize samples. \n
+* The floor, fraction, fade curves and corner hashes are worked out once per sample into block arrays.
+* Each channel then takes its gradient from its own 4 bit slice of the shared corner hashes, the
+* first 8 channels from one hash per corner and the next 8 from a second, and runs a plain loop
+* over the block. Output goes to planes when given, otherwise interleaved.
+*/
+template<typename T>
+void gmultichannel<T>::EvaluateBlock(const float* x, const float* y, int count, float* const* planes, float* interleaved) const
+{
+    float fractionX[BlockSize], fractionY[BlockSize];
+    float fadedX[BlockSize], fadedY[BlockSize];
+    unsigned int hashes[2][4][BlockSize];
+    const unsigned int seed = (unsigned int)m_gdtSeed;
+    const int hashSets = (m_iChannelCount > 8) ? 2 : 1;
+    int i = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        int cellX = FastFloorToInt(x[i]);
+        int cellY = FastFloorToInt(y[i]);
+        fractionX[i] = x[i] - (float)cellX;
+        fractionY[i] = y[i] - (float)cellY;
+        fadedX[i] = FadeFloat(fractionX[i]);
+        fadedY[i] = FadeFloat(fractionY[i]);
+
+        for (int corner = 0; corner < 4; corner++)
+        {
+            unsigned int h = HashCoordinates2D<unsigned int>(seed, cellX + (corner & 1), cellY + (corner >> 1));
+            hashes[0][corner][i] = h;
+            if (hashSets > 1) hashes[1][corner][i] = AdaptedLehmer32<unsigned int>(h);
+        }
+    }
+
+    for (int channel = 0; channel < m_iChannelCount; channel++)
+    {
+        const int set = channel >> 3;
+        const int shift = 4 * (channel & 7);
+        const unsigned int* h00 = hashes[set][0];
+        const unsigned int* h10 = hashes[set][1];
+        const unsigned int* h01 = hashes[set][2];
+        const unsigned int* h11 = hashes[set][3];
+
+        for (i = 0; i < count; i++)
+        {
+            const float* g00 = MultiChannelGradients[(h00[i] >> shift) & 15];
+            const float* g10 = MultiChannelGradients[(h10[i] >> shift) & 15];
+            const float* g01 = MultiChannelGradients[(h01[i] >> shift) & 15];
+            const float* g11 = MultiChannelGradients[(h11[i] >> shift) & 15];
+            float fx = fractionX[i];
+            float fy = fractionY[i];
+
+            float n00 = g00[0] * fx + g00[1] * fy;
+            float n10 = g10[0] * (fx - 1.0f) + g10[1] * fy;
+            float n01 = g01[0] * fx + g01[1] * (fy - 1.0f);
+            float n11 = g11[0] * (fx - 1.0f) + g11[1] * (fy - 1.0f);
+            float value = CbFloatLerp(CbFloatLerp(n00, n10, fadedX[i]), CbFloatLerp(n01, n11, fadedX[i]), fadedY[i]);
+
+            if (planes != NULL) planes[channel][i] = value;
+            else interleaved[(size_t)i * m_iChannelCount + channel] = value;
+        }
+    }
+}
+
+
+
+/**
+* \brief Evaluates every channel at one point into channels, GetChannelCount values long
+*/
+template<typename T>
+void gmultichannel<T>::Evaluate(float x, float y, float* channels) const
+{
+    EvaluateBlock(&x, &y, 1, NULL, channels);
+}
+
+
+
+/**
+* \brief Evaluates every channel for arrays of points into one array per channel. \n
+* planes holds GetChannelCount pointers, each to count floats.
+*/
+template<typename T>
+void gmultichannel<T>::EvaluatePlanar(const float* x, const float* y, size_t count, float* const* planes) const
+{
+    float* blockPlanes[MaxChannels];
+
+    for (size_t start = 0; start < count; start += BlockSize)
+    {
+        int blockCount = (int)MIN(count - start, (size_t)BlockSize);
+        for (int channel = 0; channel < m_iChannelCount; channel++) blockPlanes[channel] = planes[channel] + start;
+        EvaluateBlock(x + start, y + start, blockCount, blockPlanes, NULL);
+    }
+}
+
+
+
+/**
+* \brief Evaluates every channel for arrays of points into one array, all channels of a sample side by side. \n
+* out holds count * GetChannelCount floats.
+*/
+template<typename T>
+void gmultichannel<T>::EvaluateInterleaved(const float* x, const float* y, size_t count, float* out) const
+{
+    for (size_t start = 0; start < count; start += BlockSize)
+    {
+        int blockCount = (int)MIN(count - start, (size_t)BlockSize);
+        EvaluateBlock(x + start, y + start, blockCount, NULL, out + start * m_iChannelCount);
+    }
+}
+
+
+
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * @file gmultichannel.h
+ * @brief Header file for evaluating several decorrelated gradient noise channels in one lattice pass
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GMULTICHANNEL_H_INCLUDED
+#define GMULTICHANNEL_H_INCLUDED
+
+#include <stddef.h>
+#include "grng.h"
+#include "grandomAlgorithms.h"
+
+
+
+
+template<typename T>
+class gmultichannel
+{
+
+private:
+
+    ///Samples whose lattice decomposition is shared by every channel at a time
+    static const int BlockSize = 64;
+
+    void EvaluateBlock(const float* x, const float* y, int count, float* const* planes, float* interleaved) const;
+
+
+protected:
+
+    ///Seed the lattice corners are hashed with
+    T m_gdtSeed;
+
+    ///Channels computed per sample
+    int m_iChannelCount;
+
+
+public:
+
+    ///Most channels one evaluator computes, 8 four bit gradient slices from each of two hashes per corner
+    static const int MaxChannels = 16;
+
+    gmultichannel();
+    gmultichannel(const T newSeed, int channelCount);
+    ~gmultichannel();
+
+    /**
+    * \brief Sets this objects seed to the seed passed
+    */
+    inline void SetSeed(const T newSeed)
+    {
+        m_gdtSeed = newSeed;
+    }
+
+    /**
+    * \brief Returns this objects seed
+    */
+    const inline T GetSeed()
+    {
+        return m_gdtSeed;
+    }
+
+    void SetChannelCount(int channelCount);
+
+    /**
+    * \brief Returns the amount of channels computed per sample
+    */
+    const inline int GetChannelCount() const
+    {
+        return m_iChannelCount;
+    }
+
+    void Evaluate(float x, float y, float* channels) const;
+    void EvaluatePlanar(const float* x, const float* y, size_t count, float* const* planes) const;
+    void EvaluateInterleaved(const float* x, const float* y, size_t count, float* out) const;
+};
+
+
+
+
+#include "gmultichannel.cpp"
+
+
+#endif // GMULTICHANNEL_H_INCLUDED
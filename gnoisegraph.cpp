@@ -0,0 +1,564 @@
+/**
+ * @file gnoisegraph.cpp
+ * @brief Source file for the composable noise module graph
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GNOISEGRAPH_CPP_INCLUDED
+#define GNOISEGRAPH_CPP_INCLUDED
+
+#include <chrono>
+#include "gnoisegraph.h"
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gnoisegraph<T>::gnoisegraph()
+{
+    m_bProfiling = false;
+}
+
+
+
+/**
+* \brief Constructor
+* \param generator Generator the Perlin, Voronoi and Value nodes sample
+*/
+template<typename T>
+gnoisegraph<T>::gnoisegraph(const grng<T>& generator) : m_udtGenerator(generator)
+{
+    m_bProfiling = false;
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gnoisegraph<T>::~gnoisegraph()
+{
+    m_bProfiling = false;
+}
+
+#pragma endregion
+
+
+
+#pragma region NODE_BUILDERS
+
+/**
+* \brief Appends the node if its inputs point at existing nodes
+* \return The new node id, -1 if an input was invalid
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddNode(const NoiseNode_t& node)
+{
+    int inputCount = 0;
+
+    switch (node.type)
+    {
+    case Noise_Node_Add:
+    case Noise_Node_Multiply:
+        inputCount = 2;
+        break;
+
+    case Noise_Node_ScaleBias:
+    case Noise_Node_Clamp:
+        inputCount = 1;
+        break;
+
+    case Noise_Node_Select:
+    case Noise_Node_Warp:
+        inputCount = 3;
+        break;
+
+    default:
+        inputCount = 0;
+        break;
+    }
+
+    for (int i = 0; i < inputCount; i++)
+    {
+        if (node.inputs[i] < 0 || node.inputs[i] >= (int)m_vNodes.size()) return -1;
+    }
+
+    NoiseNodeProfile_t emptyProfile = { 0, 0, 0, 0 };
+    m_vNodes.push_back(node);
+    m_vProfiles.push_back(emptyProfile);
+    return (NoiseNodeId_t)m_vNodes.size() - 1;
+}
+
+
+
+/**
+* \brief Returns a node with every field cleared
+*/
+static NoiseNode_t EmptyNoiseNode(NoiseNodeType_t type)
+{
+    NoiseNode_t node;
+    node.type = type;
+    node.inputs[0] = node.inputs[1] = node.inputs[2] = -1;
+    node.parameters[0] = node.parameters[1] = node.parameters[2] = node.parameters[3] = 0;
+    node.useDistance = false;
+    node.seedValue = 0;
+    return node;
+}
+
+
+
+/**
+* \brief Adds a node that outputs the same value everywhere
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddConstant(float value)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Constant);
+    node.parameters[0] = value;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a Perlin2D node sampled at the coordinates times the frequency. \n
+* The seed value picks an offset within the 256 cell period of the permutation table, so Perlin nodes
+* with different seed values sample different parts of the field, such as the two inputs of a warp.
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddPerlin(float frequency, int seedValue)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Perlin);
+    const unsigned int hash = HashCoordinates2D<unsigned int>((unsigned int)seedValue, 0x6d2b79f5, 0x1b873593);
+    node.parameters[0] = frequency;
+    node.parameters[1] = (float)(hash & 0xffff) * (256.0f / 65536.0f);
+    node.parameters[2] = (float)(hash >> 16) * (256.0f / 65536.0f);
+    node.seedValue = seedValue;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a Voronoi node, the nearest feature point of gcellular::Evaluate2D shaped by CellularVoronoiValue. \n
+* The cellular seed is the generator seed plus the seed value.
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddVoronoi(float frequency, bool useDistance, float displacement, int seedValue)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Voronoi);
+    node.parameters[0] = frequency;
+    node.parameters[1] = displacement;
+    node.useDistance = useDistance;
+    node.seedValue = seedValue;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a value noise node, grng::SmoothValueNoise2D at the coordinates times the frequency
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddValue(float frequency, int seedValue)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Value);
+    node.parameters[0] = frequency;
+    node.seedValue = seedValue;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a node running any 2D noise function, such as Fractal::ToFunction2D
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddFunction(const NoiseFunction2D_t& function)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Function);
+    node.function = function;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a node outputting a + b
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddAdd(NoiseNodeId_t a, NoiseNodeId_t b)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Add);
+    node.inputs[0] = a;
+    node.inputs[1] = b;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a node outputting a * b
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddMultiply(NoiseNodeId_t a, NoiseNodeId_t b)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Multiply);
+    node.inputs[0] = a;
+    node.inputs[1] = b;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a node outputting source * scale + bias
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddScaleBias(NoiseNodeId_t source, float scale, float bias)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_ScaleBias);
+    node.inputs[0] = source;
+    node.parameters[0] = scale;
+    node.parameters[1] = bias;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a node clamping the source between the min and max value
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddClamp(NoiseNodeId_t source, float minValue, float maxValue)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Clamp);
+    node.inputs[0] = source;
+    node.parameters[0] = MIN(minValue, maxValue);
+    node.parameters[1] = MAX(minValue, maxValue);
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a node choosing between two sources by a mask. \n
+* Mask values below threshold - falloff output the low source, above threshold + falloff the high
+* source, and values in between blend the two with an s-curve. A block whose mask lies entirely on one
+* side never evaluates the other source.
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddSelect(NoiseNodeId_t mask, NoiseNodeId_t lowSource, NoiseNodeId_t highSource,
+    float threshold, float falloff)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Select);
+    node.inputs[0] = mask;
+    node.inputs[1] = lowSource;
+    node.inputs[2] = highSource;
+    node.parameters[0] = threshold;
+    node.parameters[1] = (falloff < 0) ? -falloff : falloff;
+    return AddNode(node);
+}
+
+
+
+/**
+* \brief Adds a node sampling the source at coordinates displaced by two warp nodes times the strength
+*/
+template<typename T>
+NoiseNodeId_t gnoisegraph<T>::AddWarp(NoiseNodeId_t source, NoiseNodeId_t warpX, NoiseNodeId_t warpY, float strength)
+{
+    NoiseNode_t node = EmptyNoiseNode(Noise_Node_Warp);
+    node.inputs[0] = source;
+    node.inputs[1] = warpX;
+    node.inputs[2] = warpY;
+    node.parameters[0] = strength;
+    return AddNode(node);
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Returns one of the block sized scratch buffers for the recursion level
+*/
+template<typename T>
+float* gnoisegraph<T>::ScratchBuffer(int depth, int index)
+{
+    if (depth >= (int)m_vScratchLevels.size())
+    {
+        m_vScratchLevels.resize(depth + 1);
+    }
+
+    std::vector<float>& level = m_vScratchLevels[depth];
+    if (level.empty()) level.resize((size_t)ScratchPerLevel * BlockSize);
+
+    return &level[(size_t)index * BlockSize];
+}
+
+
+
+/**
+* \brief Evaluates a node and everything feeding it over one block of samples. \n
+* Inputs are evaluated into the scratch buffers of the next recursion level, so the memory
+* used is one block per buffer per graph level no matter the size of the tile.
+* \return Nanoseconds spent when profiling, else 0
+*/
+template<typename T>
+long long gnoisegraph<T>::EvaluateNode(NoiseNodeId_t nodeId, const float* x, const float* y, int count, float* out, int depth)
+{
+    std::chrono::steady_clock::time_point startTime;
+    if (m_bProfiling) startTime = std::chrono::steady_clock::now();
+
+    const NoiseNode_t& node = m_vNodes[nodeId];
+    long long childNanoseconds = 0;
+    int k = 0;
+
+    switch (node.type)
+    {
+    case Noise_Node_Constant:
+        for (k = 0; k < count; k++) out[k] = node.parameters[0];
+        break;
+
+    case Noise_Node_Perlin:
+        for (k = 0; k < count; k++)
+        {
+            out[k] = m_udtGenerator.Perlin2D(x[k] * node.parameters[0] + node.parameters[1],
+                y[k] * node.parameters[0] + node.parameters[2]);
+        }
+        break;
+
+    case Noise_Node_Voronoi:
+    {
+        const gcellular<T> cellular((T)(m_udtGenerator.GetSeed() + node.seedValue), Cellular_Distance_Euclidean, 0.5f);
+        for (k = 0; k < count; k++)
+        {
+            out[k] = CellularVoronoiValue(cellular.Evaluate2D(x[k] * node.parameters[0], y[k] * node.parameters[0]),
+                node.useDistance, node.parameters[1]);
+        }
+        break;
+    }
+
+    case Noise_Node_Value:
+    {
+        float* scaledX = ScratchBuffer(depth, 0);
+        float* scaledY = ScratchBuffer(depth, 1);
+        for (k = 0; k < count; k++)
+        {
+            scaledX[k] = x[k] * node.parameters[0];
+            scaledY[k] = y[k] * node.parameters[0];
+        }
+        m_udtGenerator.SmoothValueNoise2D(scaledX, scaledY, out, (size_t)count, node.seedValue);
+        break;
+    }
+
+    case Noise_Node_Function:
+        for (k = 0; k < count; k++) out[k] = node.function(x[k], y[k]);
+        break;
+
+    case Noise_Node_Add:
+    {
+        float* b = ScratchBuffer(depth, 0);
+        childNanoseconds += EvaluateNode(node.inputs[0], x, y, count, out, depth + 1);
+        childNanoseconds += EvaluateNode(node.inputs[1], x, y, count, b, depth + 1);
+        for (k = 0; k < count; k++) out[k] += b[k];
+        break;
+    }
+
+    case Noise_Node_Multiply:
+    {
+        float* b = ScratchBuffer(depth, 0);
+        childNanoseconds += EvaluateNode(node.inputs[0], x, y, count, out, depth + 1);
+        childNanoseconds += EvaluateNode(node.inputs[1], x, y, count, b, depth + 1);
+        for (k = 0; k < count; k++) out[k] *= b[k];
+        break;
+    }
+
+    case Noise_Node_ScaleBias:
+        childNanoseconds += EvaluateNode(node.inputs[0], x, y, count, out, depth + 1);
+        for (k = 0; k < count; k++) out[k] = out[k] * node.parameters[0] + node.parameters[1];
+        break;
+
+    case Noise_Node_Clamp:
+        childNanoseconds += EvaluateNode(node.inputs[0], x, y, count, out, depth + 1);
+        for (k = 0; k < count; k++) out[k] = Clamp(out[k], node.parameters[0], node.parameters[1]);
+        break;
+
+    case Noise_Node_Select:
+    {
+        const float lowEdge = node.parameters[0] - node.parameters[1];
+        const float highEdge = node.parameters[0] + node.parameters[1];
+        float* mask = ScratchBuffer(depth, 0);
+        bool needLow = false;
+        bool needHigh = false;
+
+        childNanoseconds += EvaluateNode(node.inputs[0], x, y, count, mask, depth + 1);
+
+        for (k = 0; k < count; k++)
+        {
+            if (mask[k] < highEdge) needLow = true;
+            if (mask[k] > lowEdge) needHigh = true;
+        }
+
+        if (needLow && !needHigh)
+        {
+            childNanoseconds += EvaluateNode(node.inputs[1], x, y, count, out, depth + 1);
+        }
+        else if (needHigh && !needLow)
+        {
+            childNanoseconds += EvaluateNode(node.inputs[2], x, y, count, out, depth + 1);
+        }
+        else
+        {
+            float* low = ScratchBuffer(depth, 1);
+            float* high = ScratchBuffer(depth, 2);
+            childNanoseconds += EvaluateNode(node.inputs[1], x, y, count, low, depth + 1);
+            childNanoseconds += EvaluateNode(node.inputs[2], x, y, count, high, depth + 1);
+
+            const float inverseWidth = (highEdge > lowEdge) ? 1.0f / (highEdge - lowEdge) : 0.0f;
+            for (k = 0; k < count; k++)
+            {
+                float t = (highEdge > lowEdge) ? Clamp01((mask[k] - lowEdge) * inverseWidth) : (mask[k] > lowEdge ? 1.0f : 0.0f);
+                t = t * t * (3.0f - 2.0f * t);
+                out[k] = CbFloatLerp(low[k], high[k], t);
+            }
+        }
+        break;
+    }
+
+    case Noise_Node_Warp:
+    {
+        float* warpX = ScratchBuffer(depth, 0);
+        float* warpY = ScratchBuffer(depth, 1);
+        float* warpedX = ScratchBuffer(depth, 2);
+        float* warpedY = ScratchBuffer(depth, 3);
+
+        childNanoseconds += EvaluateNode(node.inputs[1], x, y, count, warpX, depth + 1);
+        childNanoseconds += EvaluateNode(node.inputs[2], x, y, count, warpY, depth + 1);
+
+        for (k = 0; k < count; k++)
+        {
+            warpedX[k] = x[k] + warpX[k] * node.parameters[0];
+            warpedY[k] = y[k] + warpY[k] * node.parameters[0];
+        }
+
+        childNanoseconds += EvaluateNode(node.inputs[0], warpedX, warpedY, count, out, depth + 1);
+        break;
+    }
+
+    default:
+        for (k = 0; k < count; k++) out[k] = 0;
+        break;
+    }
+
+    if (m_bProfiling == false) return 0;
+
+    long long inclusiveNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startTime).count();
+
+    NoiseNodeProfile_t& profile = m_vProfiles[nodeId];
+    profile.calls++;
+    profile.samples += count;
+    profile.inclusiveNanoseconds += inclusiveNanoseconds;
+    profile.exclusiveNanoseconds += inclusiveNanoseconds - childNanoseconds;
+
+    return inclusiveNanoseconds;
+}
+
+
+
+/**
+* \brief Evaluates the output node at scattered points, one fused pass per block of samples
+*/
+template<typename T>
+void gnoisegraph<T>::EvaluatePoints(NoiseNodeId_t output, const float* x, const float* y, float* out, size_t count)
+{
+    if (output < 0 || output >= (int)m_vNodes.size()) return;
+
+    for (size_t start = 0; start < count; start += BlockSize)
+    {
+        int blockCount = (int)((count - start < (size_t)BlockSize) ? count - start : BlockSize);
+        EvaluateNode(output, x + start, y + start, blockCount, out + start, 0);
+    }
+}
+
+
+
+/**
+* \brief Evaluates the output node over a regular tile, writing width * height samples row major. \n
+* No intermediate node ever holds more than one block of samples.
+*/
+template<typename T>
+void gnoisegraph<T>::EvaluateTile(NoiseNodeId_t output, float startX, float startY, float stepX, float stepY,
+    int width, int height, float* out)
+{
+    if (output < 0 || output >= (int)m_vNodes.size() || width <= 0 || height <= 0) return;
+
+    float blockX[BlockSize];
+    float blockY[BlockSize];
+    const size_t sampleCount = (size_t)width * height;
+
+    for (size_t start = 0; start < sampleCount; start += BlockSize)
+    {
+        int blockCount = (int)((sampleCount - start < (size_t)BlockSize) ? sampleCount - start : BlockSize);
+
+        for (int k = 0; k < blockCount; k++)
+        {
+            size_t sampleIndex = start + k;
+            blockX[k] = startX + (float)(sampleIndex % width) * stepX;
+            blockY[k] = startY + (float)(sampleIndex / width) * stepY;
+        }
+
+        EvaluateNode(output, blockX, blockY, blockCount, out + start, 0);
+    }
+}
+
+
+
+/**
+* \brief Turns recording of per node times on or off
+*/
+template<typename T>
+void gnoisegraph<T>::SetProfiling(bool enableProfiling)
+{
+    m_bProfiling = enableProfiling;
+}
+
+
+
+/**
+* \brief Clears every node's profiling counters
+*/
+template<typename T>
+void gnoisegraph<T>::ResetProfile()
+{
+    NoiseNodeProfile_t emptyProfile = { 0, 0, 0, 0 };
+    for (size_t i = 0; i < m_vProfiles.size(); i++) m_vProfiles[i] = emptyProfile;
+}
+
+
+
+/**
+* \brief Returns the profiling counters of a node
+*/
+template<typename T>
+NoiseNodeProfile_t gnoisegraph<T>::GetNodeProfile(NoiseNodeId_t nodeId)
+{
+    NoiseNodeProfile_t emptyProfile = { 0, 0, 0, 0 };
+    if (nodeId < 0 || nodeId >= (int)m_vProfiles.size()) return emptyProfile;
+    return m_vProfiles[nodeId];
+}
+
+
+
+
+#endif
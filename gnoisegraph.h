@@ -0,0 +1,163 @@
+/**
+ * @file gnoisegraph.h
+ * @brief Header file for the composable noise module graph
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GNOISEGRAPH_H_INCLUDED
+#define GNOISEGRAPH_H_INCLUDED
+
+#include <stddef.h>
+#include <vector>
+#include "grng.h"
+#include "gcellular.h"
+#include "gfractal.h"
+
+
+/**
+ * @brief Kinds of node a noise graph can hold
+ */
+typedef enum NoiseNodeTypes {
+
+    Noise_Node_Constant,
+    Noise_Node_Perlin,
+    Noise_Node_Voronoi,
+    Noise_Node_Value,
+    Noise_Node_Function,
+    Noise_Node_Add,
+    Noise_Node_Multiply,
+    Noise_Node_ScaleBias,
+    Noise_Node_Clamp,
+    Noise_Node_Select,
+    Noise_Node_Warp
+
+} NoiseNodeType_t;
+
+
+///Index of a node inside its graph. Negative values are invalid
+typedef int NoiseNodeId_t;
+
+
+
+/**
+ * @brief One node of a noise graph. \n
+ * Inputs always point at earlier nodes, so the graph can never hold a cycle.
+ */
+typedef struct NoiseNode {
+
+    NoiseNodeType_t type;
+    NoiseNodeId_t inputs[3];
+
+    ///Meaning depends on the type, see the Add functions of gnoisegraph
+    float parameters[4];
+    bool useDistance;
+    int seedValue;
+    NoiseFunction2D_t function;
+
+} NoiseNode_t;
+
+
+
+/**
+ * @brief Time spent in one node since profiling was enabled or reset
+ */
+typedef struct NoiseNodeProfile {
+
+    ///Times the node ran over a block of samples
+    unsigned long long calls;
+
+    ///Samples the node produced
+    unsigned long long samples;
+
+    ///Nanoseconds spent in the node and everything feeding it
+    long long inclusiveNanoseconds;
+
+    ///Nanoseconds spent in the node alone
+    long long exclusiveNanoseconds;
+
+} NoiseNodeProfile_t;
+
+
+
+
+template<typename T>
+class gnoisegraph
+{
+
+private:
+
+    ///Samples evaluated through the whole graph at a time
+    static const int BlockSize = 256;
+
+    ///Scratch buffers each recursion level needs
+    static const int ScratchPerLevel = 4;
+
+    float* ScratchBuffer(int depth, int index);
+    NoiseNodeId_t AddNode(const NoiseNode_t& node);
+    long long EvaluateNode(NoiseNodeId_t nodeId, const float* x, const float* y, int count, float* out, int depth);
+
+
+protected:
+
+    ///Generator the Perlin, Voronoi and Value nodes sample
+    grng<T> m_udtGenerator;
+
+    ///Nodes in the order they were added
+    std::vector<NoiseNode_t> m_vNodes;
+
+    ///Per node profiling counters, same order as the nodes
+    std::vector<NoiseNodeProfile_t> m_vProfiles;
+
+    ///Block sized buffers for every recursion level of the evaluation
+    std::vector<std::vector<float> > m_vScratchLevels;
+
+    ///Whether node times are being recorded
+    bool m_bProfiling;
+
+
+public:
+
+    gnoisegraph();
+    gnoisegraph(const grng<T>& generator);
+    ~gnoisegraph();
+
+    NoiseNodeId_t AddConstant(float value);
+    NoiseNodeId_t AddPerlin(float frequency, int seedValue);
+    NoiseNodeId_t AddVoronoi(float frequency, bool useDistance, float displacement, int seedValue);
+    NoiseNodeId_t AddValue(float frequency, int seedValue);
+    NoiseNodeId_t AddFunction(const NoiseFunction2D_t& function);
+    NoiseNodeId_t AddAdd(NoiseNodeId_t a, NoiseNodeId_t b);
+    NoiseNodeId_t AddMultiply(NoiseNodeId_t a, NoiseNodeId_t b);
+    NoiseNodeId_t AddScaleBias(NoiseNodeId_t source, float scale, float bias);
+    NoiseNodeId_t AddClamp(NoiseNodeId_t source, float minValue, float maxValue);
+    NoiseNodeId_t AddSelect(NoiseNodeId_t mask, NoiseNodeId_t lowSource, NoiseNodeId_t highSource, float threshold, float falloff);
+    NoiseNodeId_t AddWarp(NoiseNodeId_t source, NoiseNodeId_t warpX, NoiseNodeId_t warpY, float strength);
+
+    /**
+    * \brief Returns the amount of nodes in the graph
+    */
+    const inline int GetNodeCount()
+    {
+        return (int)m_vNodes.size();
+    }
+
+    void EvaluatePoints(NoiseNodeId_t output, const float* x, const float* y, float* out, size_t count);
+    void EvaluateTile(NoiseNodeId_t output, float startX, float startY, float stepX, float stepY,
+        int width, int height, float* out);
+
+    void SetProfiling(bool enableProfiling);
+    void ResetProfile();
+    NoiseNodeProfile_t GetNodeProfile(NoiseNodeId_t nodeId);
+};
+
+
+
+
+#include "gnoisegraph.cpp"
+
+
+#endif // GNOISEGRAPH_H_INCLUDED
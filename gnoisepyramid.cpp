@@ -0,0 +1,261 @@
+/**
+ * @file gnoisepyramid.cpp
+ * @brief Source file for the multi level of detail noise pyramid that reuses coarse octaves
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GNOISEPYRAMID_CPP_INCLUDED
+#define GNOISEPYRAMID_CPP_INCLUDED
+
+#include "gnoisepyramid.h"
+
+
+#pragma region STATIC_MATH
+
+/// <summary>
+/// Catmull-Rom interpolation halfway between p1 and p2
+/// </summary>
+static inline float CatmullRomMidpoint(float p0, float p1, float p2, float p3) {
+    return (9.0f * (p1 + p2) - p0 - p3) * 0.0625f;
+}
+
+#pragma endregion
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor, takes the octave table from a Fractal built with the same arguments
+* \param baseNoise The noise every octave samples
+* \param settings The fractal settings
+* \param seed Seed for the per octave coordinate offsets
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+NoisePyramid<BaseNoise, Variant>::NoisePyramid(const BaseNoise& baseNoise, const FractalSettings_t& settings, unsigned long long seed)
+    : m_udtBaseNoise(baseNoise)
+{
+    static_assert(Variant != Fractal_Variant_Ridged, "Ridged octaves depend on the octave before them and cannot be accumulated separately");
+    m_vOctaves = Fractal<BaseNoise, Variant>(baseNoise, settings, seed).GetOctaves();
+    m_fReuseSamplesPerCycle = 8.0f;
+    m_ullEvaluations = 0;
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+NoisePyramid<BaseNoise, Variant>::~NoisePyramid()
+{
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Sets how many samples per cycle an octave needs before it is upsampled from a coarser level
+* instead of evaluated again. Higher is closer to evaluating every level on its own, lower is faster. \n
+* At 8, the default, the Catmull-Rom upsampling of a single sine is off by under 1%.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void NoisePyramid<BaseNoise, Variant>::SetReuseSamplesPerCycle(float samplesPerCycle)
+{
+    m_fReuseSamplesPerCycle = (samplesPerCycle < 2.0f) ? 2.0f : samplesPerCycle;
+}
+
+
+
+/**
+* \brief Adds the shaped octaves to every sample of a side * side grid whose first sample sits border
+* samples before (startX, startY)
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void NoisePyramid<BaseNoise, Variant>::AddOctaves(std::vector<float>& grid, int side, int border, float startX, float startY,
+    float spacing, const std::vector<int>& octaves)
+{
+    for (size_t k = 0; k < octaves.size(); k++)
+    {
+        const FractalOctave_t& octave = m_vOctaves[octaves[k]];
+
+        for (int y = 0; y < side; y++)
+        {
+            float sampleY = (startY + (float)(y - border) * spacing) * octave.frequency + octave.offsetY;
+            float* row = &grid[(size_t)y * side];
+
+            for (int x = 0; x < side; x++)
+            {
+                float sampleX = (startX + (float)(x - border) * spacing) * octave.frequency + octave.offsetX;
+                row[x] += Fractal<BaseNoise, Variant>::ShapeOctave(m_udtBaseNoise(sampleX, sampleY)) * octave.amplitude;
+            }
+        }
+
+        m_ullEvaluations += (unsigned long long)side * side;
+    }
+}
+
+
+
+/**
+* \brief Doubles the sample density of an accumulator, apron included. \n
+* Samples shared with the coarse level are copied and the new ones are Catmull-Rom midpoints,
+* first along x for the coarse rows and then along y for every column.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void NoisePyramid<BaseNoise, Variant>::UpsampleAccumulator(const std::vector<float>& coarse, int coarseSide,
+    std::vector<float>& fine, int fineSide) const
+{
+    std::vector<float> rows((size_t)fineSide * coarseSide);
+
+    for (int y = 0; y < coarseSide; y++)
+    {
+        const float* source = &coarse[(size_t)y * coarseSide];
+        float* target = &rows[(size_t)y * fineSide];
+
+        for (int x = 0; x < fineSide; x++)
+        {
+            int offset = x - Apron;
+            if ((offset & 1) == 0)
+            {
+                target[x] = source[Apron + offset / 2];
+            }
+            else
+            {
+                int c = Apron + (offset - 1) / 2;
+                target[x] = CatmullRomMidpoint(source[c - 1], source[c], source[c + 1], source[c + 2]);
+            }
+        }
+    }
+
+    fine.resize((size_t)fineSide * fineSide);
+
+    for (int y = 0; y < fineSide; y++)
+    {
+        int offset = y - Apron;
+        float* target = &fine[(size_t)y * fineSide];
+
+        if ((offset & 1) == 0)
+        {
+            const float* source = &rows[(size_t)(Apron + offset / 2) * fineSide];
+            for (int x = 0; x < fineSide; x++) target[x] = source[x];
+        }
+        else
+        {
+            int c = Apron + (offset - 1) / 2;
+            const float* p0 = &rows[(size_t)(c - 1) * fineSide];
+            const float* p1 = &rows[(size_t)c * fineSide];
+            const float* p2 = &rows[(size_t)(c + 1) * fineSide];
+            const float* p3 = &rows[(size_t)(c + 2) * fineSide];
+            for (int x = 0; x < fineSide; x++) target[x] = CatmullRomMidpoint(p0[x], p1[x], p2[x], p3[x]);
+        }
+    }
+}
+
+
+
+/**
+* \brief Generates every level of detail of a square region in one call, coarsest first. \n
+* Each octave is evaluated once, at the coarsest level where it has m_fReuseSamplesPerCycle samples
+* per cycle, into an accumulator that is upsampled to every finer level. A level then only evaluates
+* the octaves that become well sampled at it, plus the few that are visible but not yet well sampled
+* there. Octaves above a level's Nyquist limit are left out of it.
+* \param originX World x of the first sample
+* \param originY World y of the first sample
+* \param size World width and height of the region
+* \param coarsestCells Sample intervals along one side of the coarsest level
+* \param levelCount Amount of levels, each doubling the intervals of the one before
+* \param levels Receives the levels, coarsest first
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void NoisePyramid<BaseNoise, Variant>::Generate(float originX, float originY, float size, int coarsestCells, int levelCount,
+    std::vector<NoisePyramidLevel_t>& levels)
+{
+    if (coarsestCells < 1) coarsestCells = 1;
+    if (levelCount < 1) levelCount = 1;
+    if (levelCount > 16) levelCount = 16;
+
+    const int octaveAmount = (int)m_vOctaves.size();
+    const float coarsestSpacing = size / (float)coarsestCells;
+    m_ullEvaluations = 0;
+    levels.resize(levelCount);
+
+    //The first level each octave is well sampled at, or levelCount if none is fine enough
+    std::vector<int> reuseLevels(octaveAmount, levelCount);
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        float samplesPerCycle = 1.0f / std::fabs(m_vOctaves[i].frequency * coarsestSpacing);
+        for (int level = 0; level < levelCount; level++)
+        {
+            if (samplesPerCycle >= m_fReuseSamplesPerCycle)
+            {
+                reuseLevels[i] = level;
+                break;
+            }
+            samplesPerCycle *= 2.0f;
+        }
+    }
+
+    std::vector<float> accumulator;
+    std::vector<float> upsampled;
+    int accumulatorSide = 0;
+
+    for (int level = 0; level < levelCount; level++)
+    {
+        const int cells = coarsestCells << level;
+        const int samplesPerSide = cells + 1;
+        const int side = samplesPerSide + 2 * Apron;
+        const float spacing = size / (float)cells;
+
+        if (level == 0)
+        {
+            accumulator.assign((size_t)side * side, 0.0f);
+        }
+        else
+        {
+            UpsampleAccumulator(accumulator, accumulatorSide, upsampled, side);
+            accumulator.swap(upsampled);
+        }
+        accumulatorSide = side;
+
+        std::vector<int> reusedOctaves;
+        std::vector<int> detailOctaves;
+        for (int i = 0; i < octaveAmount; i++)
+        {
+            if (reuseLevels[i] == level)
+            {
+                reusedOctaves.push_back(i);
+            }
+            else if (reuseLevels[i] > level && std::fabs(m_vOctaves[i].frequency * spacing) <= 0.5f)
+            {
+                detailOctaves.push_back(i);
+            }
+        }
+
+        AddOctaves(accumulator, side, Apron, originX, originY, spacing, reusedOctaves);
+
+        NoisePyramidLevel_t& output = levels[level];
+        output.samplesPerSide = samplesPerSide;
+        output.sampleSpacing = spacing;
+        output.values.resize((size_t)samplesPerSide * samplesPerSide);
+
+        for (int y = 0; y < samplesPerSide; y++)
+        {
+            const float* source = &accumulator[(size_t)(y + Apron) * side + Apron];
+            float* target = &output.values[(size_t)y * samplesPerSide];
+            for (int x = 0; x < samplesPerSide; x++) target[x] = source[x];
+        }
+
+        AddOctaves(output.values, samplesPerSide, 0, originX, originY, spacing, detailOctaves);
+    }
+}
+
+
+
+
+#endif
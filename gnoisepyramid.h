@@ -0,0 +1,99 @@
+/**
+ * @file gnoisepyramid.h
+ * @brief Header file for the multi level of detail noise pyramid that reuses coarse octaves
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GNOISEPYRAMID_H_INCLUDED
+#define GNOISEPYRAMID_H_INCLUDED
+
+#include <stddef.h>
+#include <vector>
+#include "grng.h"
+#include "gfractal.h"
+
+
+/**
+ * @brief One level of a noise pyramid. \n
+ * Holds samplesPerSide * samplesPerSide samples, row major by y. Every level covers the same region,
+ * and each finer level has twice the samples per side minus one, so the samples of a level are the
+ * even samples of the next finer one.
+ */
+typedef struct NoisePyramidLevel {
+
+    int samplesPerSide;
+
+    ///World distance between neighbouring samples
+    float sampleSpacing;
+
+    std::vector<float> values;
+
+    inline float At(int x, int y) const
+    {
+        return values[(size_t)y * samplesPerSide + x];
+    }
+
+} NoisePyramidLevel_t;
+
+
+
+
+template<typename BaseNoise, FractalVariant_t Variant = Fractal_Variant_FBm>
+class NoisePyramid
+{
+
+private:
+
+    ///Extra samples kept around each accumulator so upsampling never reads past an edge
+    static const int Apron = 2;
+
+    void AddOctaves(std::vector<float>& grid, int side, int border, float startX, float startY, float spacing,
+        const std::vector<int>& octaves);
+    void UpsampleAccumulator(const std::vector<float>& coarse, int coarseSide, std::vector<float>& fine, int fineSide) const;
+
+
+protected:
+
+    ///The noise every octave samples
+    BaseNoise m_udtBaseNoise;
+
+    ///Frequency, amplitude and offsets of every octave, the same a Fractal with the same settings uses
+    std::vector<FractalOctave_t> m_vOctaves;
+
+    ///Samples per cycle an octave needs before it is accumulated and upsampled instead of re-evaluated
+    float m_fReuseSamplesPerCycle;
+
+    ///Base noise evaluations made by the last Generate
+    unsigned long long m_ullEvaluations;
+
+
+public:
+
+    NoisePyramid(const BaseNoise& baseNoise, const FractalSettings_t& settings, unsigned long long seed);
+    ~NoisePyramid();
+
+    void SetReuseSamplesPerCycle(float samplesPerCycle);
+
+    /**
+    * \brief Returns the amount of base noise evaluations the last Generate made
+    */
+    const inline unsigned long long GetEvaluationCount()
+    {
+        return m_ullEvaluations;
+    }
+
+    void Generate(float originX, float originY, float size, int coarsestCells, int levelCount,
+        std::vector<NoisePyramidLevel_t>& levels);
+};
+
+
+
+
+#include "gnoisepyramid.cpp"
+
+
+#endif // GNOISEPYRAMID_H_INCLUDED
@@ -0,0 +1,293 @@
+/**
+ * @file gnoisestream.cpp
+ * @brief Source file for block streaming 1D noise over many independent streams
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GNOISESTREAM_CPP_INCLUDED
+#define GNOISESTREAM_CPP_INCLUDED
+
+#include "gnoisestream.h"
+
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gnoisestream<T>::gnoisestream()
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = 0;
+    m_gdtSeed |= 6256256;
+    m_udtType = Stream_Noise_Gradient;
+}
+
+
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gnoisestream<T>::gnoisestream(const T newSeed, StreamNoiseType_t type)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    m_udtType = type;
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gnoisestream<T>::~gnoisestream()
+{
+    m_gdtSeed = 0;
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Returns the gradient or value, -1 - 1, a stream has at a lattice point
+*/
+template<typename T>
+inline float gnoisestream<T>::LatticeValue(int stream, long long cell) const
+{
+    unsigned int hash = HashCoordinates2D<unsigned int>(m_vStreamSeeds[stream], (int)cell, (int)(cell >> 32));
+    return (float)(hash >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+
+
+/**
+* \brief Moves a stream into a cell, reusing the right lattice point when it is the next cell over
+*/
+template<typename T>
+void gnoisestream<T>::MoveToCell(int stream, long long cell)
+{
+    if (cell == m_vCells[stream] + 1)
+    {
+        m_vLeft[stream] = m_vRight[stream];
+    }
+    else
+    {
+        m_vLeft[stream] = LatticeValue(stream, cell);
+    }
+
+    m_vRight[stream] = LatticeValue(stream, cell + 1);
+    m_vCells[stream] = cell;
+}
+
+
+
+/**
+* \brief Adds a stream starting at sample 0 and returns its index. \n
+* frequency is in lattice cells per second, so frequency / sampleRate cells pass per sample.
+*/
+template<typename T>
+int gnoisestream<T>::AddStream(float frequency, float sampleRate, float amplitude)
+{
+    int stream = (int)m_vSteps.size();
+
+    m_vStreamSeeds.push_back(HashCoordinates2D<unsigned int>((unsigned int)m_gdtSeed, stream, 0x5bd1e995));
+    m_vCells.push_back(0);
+    m_vPhases.push_back(0);
+    m_vSteps.push_back(0);
+    m_vAmplitudes.push_back(amplitude);
+    m_vLeft.push_back(0);
+    m_vRight.push_back(0);
+
+    SetStreamFrequency(stream, frequency, sampleRate);
+    Seek(stream, 0);
+    return stream;
+}
+
+
+
+/**
+* \brief Changes how fast a stream moves through the lattice from its current position on
+*/
+template<typename T>
+void gnoisestream<T>::SetStreamFrequency(int stream, float frequency, float sampleRate)
+{
+    if (stream < 0 || stream >= (int)m_vSteps.size()) return;
+
+    float step = (sampleRate > 0) ? frequency / sampleRate : 0.0f;
+    m_vSteps[stream] = (step < 0) ? -step : step;
+}
+
+
+
+/**
+* \brief Sets the amplitude the noise of a stream is scaled by
+*/
+template<typename T>
+void gnoisestream<T>::SetStreamAmplitude(int stream, float amplitude)
+{
+    if (stream < 0 || stream >= (int)m_vSteps.size()) return;
+    m_vAmplitudes[stream] = amplitude;
+}
+
+
+
+/**
+* \brief Moves a stream so its next sample is sample sampleIndex at its current frequency
+*/
+template<typename T>
+void gnoisestream<T>::Seek(int stream, double sampleIndex)
+{
+    if (stream < 0 || stream >= (int)m_vSteps.size()) return;
+
+    double position = sampleIndex * (double)m_vSteps[stream];
+    double cell = std::floor(position);
+
+    m_vPhases[stream] = (float)(position - cell);
+    //Not the cell before, so both lattice points get hashed
+    m_vCells[stream] = (long long)cell - 2;
+    MoveToCell(stream, (long long)cell);
+}
+
+
+
+/**
+* \brief Removes every stream
+*/
+template<typename T>
+void gnoisestream<T>::Clear()
+{
+    m_vStreamSeeds.clear();
+    m_vCells.clear();
+    m_vPhases.clear();
+    m_vSteps.clear();
+    m_vAmplitudes.clear();
+    m_vLeft.clear();
+    m_vRight.clear();
+}
+
+
+
+/**
+* \brief Writes the next count samples of one stream to out, stride floats apart. \n
+* Samples are produced a cell at a time. Inside a cell the position is start + i * step, so the run
+* is a branch free loop of a fade and a lerp per sample and the lattice is only hashed once per cell
+* crossed, however many samples the cell covers.
+*/
+template<typename T>
+void gnoisestream<T>::FillStream(int stream, float* out, size_t stride, int count)
+{
+    const float step = m_vSteps[stream];
+    const float amplitude = m_vAmplitudes[stream];
+    const bool gradient = (m_udtType == Stream_Noise_Gradient);
+    float phase = m_vPhases[stream];
+    int written = 0;
+
+    while (written < count)
+    {
+        int run = count - written;
+        if (step > 0)
+        {
+            float remaining = (1.0f - phase) / step;
+            if (remaining < (float)run) run = (int)std::ceil(remaining);
+            if (run < 1) run = 1;
+        }
+
+        const float left = m_vLeft[stream];
+        const float right = m_vRight[stream];
+        float* target = out + (size_t)written * stride;
+
+        if (gradient)
+        {
+            const float scaledLeft = left * amplitude * 2.0f;
+            const float scaledRight = right * amplitude * 2.0f;
+            for (int i = 0; i < run; i++)
+            {
+                float f = phase + (float)i * step;
+                target[(size_t)i * stride] = CbFloatLerp(scaledLeft * f, scaledRight * (f - 1.0f), FadeFloat(f));
+            }
+        }
+        else
+        {
+            const float scaledLeft = left * amplitude;
+            const float scaledRight = right * amplitude;
+            for (int i = 0; i < run; i++)
+            {
+                float f = phase + (float)i * step;
+                target[(size_t)i * stride] = CbFloatLerp(scaledLeft, scaledRight, FadeFloat(f));
+            }
+        }
+
+        written += run;
+        phase += (float)run * step;
+
+        if (phase >= 1.0f)
+        {
+            float cellsCrossed = std::floor(phase);
+            phase -= cellsCrossed;
+            MoveToCell(stream, m_vCells[stream] + (long long)cellsCrossed);
+        }
+    }
+
+    m_vPhases[stream] = phase;
+}
+
+
+
+/**
+* \brief Writes the next count samples of one stream to out
+*/
+template<typename T>
+void gnoisestream<T>::Fill(int stream, float* out, int count)
+{
+    if (stream < 0 || stream >= (int)m_vSteps.size() || out == NULL || count <= 0) return;
+    FillStream(stream, out, 1, count);
+}
+
+
+
+/**
+* \brief Writes the next count samples of every stream, stream s to outs[s]
+*/
+template<typename T>
+void gnoisestream<T>::FillPlanar(float* const* outs, int count)
+{
+    if (outs == NULL || count <= 0) return;
+
+    const int streamCount = (int)m_vSteps.size();
+    for (int stream = 0; stream < streamCount; stream++)
+    {
+        FillStream(stream, outs[stream], 1, count);
+    }
+}
+
+
+
+/**
+* \brief Writes the next count samples of every stream as frames, sample i of stream s to out[i * GetStreamCount() + s]
+*/
+template<typename T>
+void gnoisestream<T>::FillInterleaved(float* out, int count)
+{
+    if (out == NULL || count <= 0) return;
+
+    const int streamCount = (int)m_vSteps.size();
+    for (int stream = 0; stream < streamCount; stream++)
+    {
+        FillStream(stream, out + stream, (size_t)streamCount, count);
+    }
+}
+
+
+
+
+#endif
@@ -0,0 +1,110 @@
+/**
+ * @file gnoisestream.h
+ * @brief Header file for block streaming 1D noise over many independent streams
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GNOISESTREAM_H_INCLUDED
+#define GNOISESTREAM_H_INCLUDED
+
+#include <stddef.h>
+#include <vector>
+#include "grng.h"
+#include "grandomAlgorithms.h"
+
+
+/**
+ * @brief Kinds of 1D noise a stream can produce
+ */
+typedef enum StreamNoiseTypes {
+
+    ///Hashed gradient noise like Perlin1D, zero at every lattice point
+    Stream_Noise_Gradient,
+
+    ///Hashed values at the lattice points blended with the fade curve
+    Stream_Noise_Value
+
+} StreamNoiseType_t;
+
+
+
+
+template<typename T>
+class gnoisestream
+{
+
+private:
+
+    inline float LatticeValue(int stream, long long cell) const;
+    void MoveToCell(int stream, long long cell);
+    void FillStream(int stream, float* out, size_t stride, int count);
+
+
+protected:
+
+    ///Seed every stream seed is hashed from
+    T m_gdtSeed;
+
+    ///The noise every stream produces
+    StreamNoiseType_t m_udtType;
+
+    ///Per stream state, one entry per stream
+    std::vector<unsigned int> m_vStreamSeeds;
+    std::vector<long long> m_vCells;
+
+    ///Position inside the current cell, 0 - 1
+    std::vector<float> m_vPhases;
+
+    ///Cells advanced per sample, frequency / sample rate
+    std::vector<float> m_vSteps;
+    std::vector<float> m_vAmplitudes;
+
+    ///Lattice gradients or values at the left and right edge of the current cell
+    std::vector<float> m_vLeft;
+    std::vector<float> m_vRight;
+
+
+public:
+
+    gnoisestream();
+    gnoisestream(const T newSeed, StreamNoiseType_t type);
+    ~gnoisestream();
+
+    /**
+    * \brief Returns this objects seed
+    */
+    const inline T GetSeed()
+    {
+        return m_gdtSeed;
+    }
+
+    /**
+    * \brief Returns the amount of streams
+    */
+    const inline int GetStreamCount() const
+    {
+        return (int)m_vSteps.size();
+    }
+
+    int AddStream(float frequency, float sampleRate, float amplitude);
+    void SetStreamFrequency(int stream, float frequency, float sampleRate);
+    void SetStreamAmplitude(int stream, float amplitude);
+    void Seek(int stream, double sampleIndex);
+    void Clear();
+
+    void Fill(int stream, float* out, int count);
+    void FillPlanar(float* const* outs, int count);
+    void FillInterleaved(float* out, int count);
+};
+
+
+
+
+#include "gnoisestream.cpp"
+
+
+#endif // GNOISESTREAM_H_INCLUDED
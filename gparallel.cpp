@@ -0,0 +1,81 @@
+/**
+ * @file gparallel.cpp
+ * @brief Source file for splitting batch noise work across threads
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GPARALLEL_CPP_INCLUDED
+#define GPARALLEL_CPP_INCLUDED
+
+#include "gparallel.h"
+
+
+/// <summary>
+/// Turns a requested thread count into the amount of threads actually worth using. \n
+/// Zero or less asks for one thread per hardware thread, and no thread is given less than ParallelMinimumRange items.
+/// </summary>
+/// <param name="threadCount"></param>
+/// <param name="count"></param>
+/// <returns></returns>
+inline int ResolveThreadCount(int threadCount, size_t count)
+{
+    if (threadCount <= 0)
+    {
+        threadCount = (int)std::thread::hardware_concurrency();
+        if (threadCount <= 0) threadCount = 1;
+    }
+
+    size_t usefulThreads = count / ParallelMinimumRange;
+    if (usefulThreads < 1) usefulThreads = 1;
+    if ((size_t)threadCount > usefulThreads) threadCount = (int)usefulThreads;
+
+    return threadCount;
+}
+
+
+
+/**
+* \brief Calls function(begin, end) over contiguous ranges that together cover 0 - count. \n
+* The calling thread takes the first range itself, the rest each get a std::thread that is joined
+* before returning. Ranges never overlap, so the function may write its outputs without locking.
+*/
+template<typename Function>
+void ParallelForRange(size_t count, int threadCount, Function function)
+{
+    if (count == 0) return;
+
+    const int usedThreads = ResolveThreadCount(threadCount, count);
+    if (usedThreads == 1)
+    {
+        function((size_t)0, count);
+        return;
+    }
+
+    const size_t rangeSize = (count + usedThreads - 1) / usedThreads;
+    std::vector<std::thread> workers;
+    workers.reserve(usedThreads - 1);
+
+    for (int i = 1; i < usedThreads; i++)
+    {
+        size_t begin = rangeSize * i;
+        size_t end = (begin + rangeSize < count) ? begin + rangeSize : count;
+        if (begin >= end) break;
+        workers.push_back(std::thread(function, begin, end));
+    }
+
+    function((size_t)0, (rangeSize < count) ? rangeSize : count);
+
+    for (size_t i = 0; i < workers.size(); i++)
+    {
+        workers[i].join();
+    }
+}
+
+
+
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file gparallel.h
+ * @brief Header file for splitting batch noise work across threads
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GPARALLEL_H_INCLUDED
+#define GPARALLEL_H_INCLUDED
+
+#include <stddef.h>
+#include <thread>
+#include <vector>
+
+
+///Fewest items worth handing to a thread of their own
+static const size_t ParallelMinimumRange = 1024;
+
+
+int ResolveThreadCount(int threadCount, size_t count);
+
+template<typename Function>
+void ParallelForRange(size_t count, int threadCount, Function function);
+
+
+
+
+#include "gparallel.cpp"
+
+
+#endif // GPARALLEL_H_INCLUDED
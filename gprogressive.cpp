@@ -0,0 +1,150 @@
+/**
+ * @file gprogressive.cpp
+ * @brief Source file for the resumable fractal accumulator that adds octaves to a map a few at a time
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GPROGRESSIVE_CPP_INCLUDED
+#define GPROGRESSIVE_CPP_INCLUDED
+
+#include "gprogressive.h"
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor, lays out the map and takes the octave table from a Fractal built with the same settings
+* \param baseNoise The noise every octave samples
+* \param settings The fractal settings
+* \param seed Seed for the per octave coordinate offsets
+* \param width Samples along x
+* \param height Samples along y
+* \param startX World x of the first sample
+* \param startY World y of the first sample
+* \param spacing World distance between neighbouring samples
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+ProgressiveFractal<BaseNoise, Variant>::ProgressiveFractal(const BaseNoise& baseNoise, const FractalSettings_t& settings,
+    unsigned long long seed, int width, int height, float startX, float startY, float spacing)
+    : m_udtBaseNoise(baseNoise), m_bCancelRequested(false)
+{
+    m_udtSettings = settings;
+    m_vOctaves = Fractal<BaseNoise, Variant>(baseNoise, settings, seed).GetOctaves();
+    m_iWidth = (width > 0) ? width : 0;
+    m_iHeight = (height > 0) ? height : 0;
+    m_fStartX = startX;
+    m_fStartY = startY;
+    m_fSpacing = spacing;
+    Reset();
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+ProgressiveFractal<BaseNoise, Variant>::~ProgressiveFractal()
+{
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Clears the partial sum so octaves are added from the first one again
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void ProgressiveFractal<BaseNoise, Variant>::Reset()
+{
+    const size_t sampleCount = (size_t)m_iWidth * m_iHeight;
+    m_vValues.assign(sampleCount, 0.0f);
+    if (Variant == Fractal_Variant_Ridged) m_vWeights.assign(sampleCount, 1.0f);
+    m_iCompletedOctaves = 0;
+    m_fCompletedAmplitude = 0;
+    m_bCancelRequested = false;
+}
+
+
+
+/**
+* \brief Adds one octave to every sample of the map, the same way Fractal::Evaluate would
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void ProgressiveFractal<BaseNoise, Variant>::AddOctave(int octaveIndex)
+{
+    const FractalOctave_t& octave = m_vOctaves[octaveIndex];
+
+    for (int y = 0; y < m_iHeight; y++)
+    {
+        float sampleY = (m_fStartY + (float)y * m_fSpacing) * octave.frequency + octave.offsetY;
+        float* row = &m_vValues[(size_t)y * m_iWidth];
+
+        if (Variant == Fractal_Variant_Ridged)
+        {
+            float* weights = &m_vWeights[(size_t)y * m_iWidth];
+            for (int x = 0; x < m_iWidth; x++)
+            {
+                float sampleX = (m_fStartX + (float)x * m_fSpacing) * octave.frequency + octave.offsetX;
+                float noise = m_udtBaseNoise(sampleX, sampleY);
+                row[x] += Fractal<BaseNoise, Variant>::RidgeOctave(noise, m_udtSettings, weights[x]) * octave.amplitude;
+            }
+        }
+        else
+        {
+            for (int x = 0; x < m_iWidth; x++)
+            {
+                float sampleX = (m_fStartX + (float)x * m_fSpacing) * octave.frequency + octave.offsetX;
+                row[x] += Fractal<BaseNoise, Variant>::ShapeOctave(m_udtBaseNoise(sampleX, sampleY)) * octave.amplitude;
+            }
+        }
+    }
+
+    m_fCompletedAmplitude += octave.amplitude;
+}
+
+
+
+/**
+* \brief Adds up to octaveCount more octaves on top of the ones already summed. \n
+* Earlier octaves are never recomputed, so calling this until IsComplete does the same work as
+* evaluating the full fractal once. A cancel request is honoured before each octave, leaving the
+* map holding whole octaves only, and the next call carries on from there.
+* \return The amount of octaves actually added
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+int ProgressiveFractal<BaseNoise, Variant>::AddOctaves(int octaveCount)
+{
+    int added = 0;
+
+    while (added < octaveCount && !IsComplete())
+    {
+        if (m_bCancelRequested.exchange(false)) break;
+        AddOctave(m_iCompletedOctaves);
+        m_iCompletedOctaves++;
+        added++;
+    }
+
+    return added;
+}
+
+
+
+/**
+* \brief Asks a running or upcoming AddOctaves to stop before its next octave. Safe to call from any thread.
+*/
+template<typename BaseNoise, FractalVariant_t Variant>
+void ProgressiveFractal<BaseNoise, Variant>::RequestCancel()
+{
+    m_bCancelRequested = true;
+}
+
+
+
+
+#endif
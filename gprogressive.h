@@ -0,0 +1,123 @@
+/**
+ * @file gprogressive.h
+ * @brief Header file for the resumable fractal accumulator that adds octaves to a map a few at a time
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GPROGRESSIVE_H_INCLUDED
+#define GPROGRESSIVE_H_INCLUDED
+
+#include <stddef.h>
+#include <atomic>
+#include <vector>
+#include "grng.h"
+#include "gfractal.h"
+
+
+
+
+template<typename BaseNoise, FractalVariant_t Variant = Fractal_Variant_FBm>
+class ProgressiveFractal
+{
+
+private:
+
+    void AddOctave(int octaveIndex);
+
+
+protected:
+
+    ///The noise every octave samples
+    BaseNoise m_udtBaseNoise;
+
+    ///Settings the octave table was built from, the ridged variant reads its offset and gain
+    FractalSettings_t m_udtSettings;
+
+    ///Frequency, amplitude and offsets of every octave, the same a Fractal with the same settings uses
+    std::vector<FractalOctave_t> m_vOctaves;
+
+    ///Map layout, row major by y
+    int m_iWidth;
+    int m_iHeight;
+    float m_fStartX;
+    float m_fStartY;
+    float m_fSpacing;
+
+    ///Sum of the octaves added so far
+    std::vector<float> m_vValues;
+
+    ///Ridged variant only, the weight each sample carries into its next octave
+    std::vector<float> m_vWeights;
+
+    ///Octaves already in m_vValues
+    int m_iCompletedOctaves;
+
+    ///Sum of the amplitudes of the octaves already added
+    float m_fCompletedAmplitude;
+
+    ///Set from any thread to stop AddOctaves before its next octave
+    std::atomic<bool> m_bCancelRequested;
+
+
+public:
+
+    ProgressiveFractal(const BaseNoise& baseNoise, const FractalSettings_t& settings, unsigned long long seed,
+        int width, int height, float startX, float startY, float spacing);
+    ~ProgressiveFractal();
+
+    int AddOctaves(int octaveCount);
+    void RequestCancel();
+    void Reset();
+
+    /**
+    * \brief Returns the partial sum, width * height samples row major by y
+    */
+    const inline float* GetValues() const
+    {
+        return m_vValues.empty() ? NULL : &m_vValues[0];
+    }
+
+    /**
+    * \brief Returns the amount of octaves added so far
+    */
+    const inline int GetCompletedOctaves() const
+    {
+        return m_iCompletedOctaves;
+    }
+
+    /**
+    * \brief Returns the amount of octaves the settings describe
+    */
+    const inline int GetOctaveAmount() const
+    {
+        return (int)m_vOctaves.size();
+    }
+
+    /**
+    * \brief Returns whether every octave has been added
+    */
+    const inline bool IsComplete() const
+    {
+        return m_iCompletedOctaves >= (int)m_vOctaves.size();
+    }
+
+    /**
+    * \brief Returns the sum of the amplitudes added so far, for normalizing a preview
+    */
+    const inline float GetCompletedAmplitude() const
+    {
+        return m_fCompletedAmplitude;
+    }
+};
+
+
+
+
+#include "gprogressive.cpp"
+
+
+#endif // GPROGRESSIVE_H_INCLUDED
@@ -0,0 +1,182 @@
+/**
+ * @file gquantize.cpp
+ * @brief Source file for writing noise straight into 8 bit, 16 bit and half float samples
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GQUANTIZE_CPP_INCLUDED
+#define GQUANTIZE_CPP_INCLUDED
+
+#include "gquantize.h"
+
+
+/// <summary>
+/// Bytes one sample takes in the format
+/// </summary>
+/// <param name="format"></param>
+/// <returns></returns>
+inline size_t QuantizedFormatBytes(QuantizedFormat_t format)
+{
+    return (format == Quantized_Format_Unorm8) ? 1 : 2;
+}
+
+
+
+/// <summary>
+/// Converts a float to half float bits, rounding to nearest even. \n
+/// Values too large become infinity and values too small for a half subnormal become zero. Every case is
+/// worked out and the result selected, with no branches, so loops over it vectorize.
+/// </summary>
+/// <param name="value"></param>
+/// <returns></returns>
+inline unsigned short FloatToHalf(float value)
+{
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    const unsigned int sign = (bits >> 16) & 0x8000;
+    const unsigned int absolute = bits & 0x7fffffff;
+
+    //Half subnormals and zero, adding 0.5 lines the half mantissa up with the low float mantissa bits
+    //and the float add rounds it to nearest even
+    float magnitude;
+    memcpy(&magnitude, &absolute, sizeof(magnitude));
+    magnitude += 0.5f;
+    unsigned int subnormal;
+    memcpy(&subnormal, &magnitude, sizeof(subnormal));
+    subnormal -= 0x3f000000;
+
+    //Half normals, rebias the exponent and round the 13 dropped bits to nearest even.
+    //A carry out of the mantissa correctly rolls into the exponent
+    const unsigned int normal = (absolute + 0xc8000fff + ((absolute >> 13) & 1)) >> 13;
+
+    //Masks rather than ?: since gcc turns those back into branches here. Infinity for values of 65536
+    //and up, NaN stays a NaN
+    const unsigned int subnormalMask = 0u - (unsigned int)(absolute < 0x38800000);
+    const unsigned int infinityMask = 0u - (unsigned int)(absolute >= 0x47800000);
+    const unsigned int nanMask = 0u - (unsigned int)(absolute > 0x7f800000);
+
+    unsigned int half = (subnormal & subnormalMask) | (normal & ~subnormalMask);
+    half = (half & ~infinityMask) | ((0x7c00 | (nanMask & 0x200)) & infinityMask);
+    return (unsigned short)(sign | half);
+}
+
+
+
+/// <summary>
+/// Converts half float bits back to a float
+/// </summary>
+/// <param name="value"></param>
+/// <returns></returns>
+inline float HalfToFloat(unsigned short value)
+{
+    const unsigned int sign = ((unsigned int)value & 0x8000) << 16;
+    unsigned int exponent = ((unsigned int)value >> 10) & 0x1f;
+    unsigned int mantissa = (unsigned int)value & 0x3ff;
+    unsigned int bits;
+
+    if (exponent == 0x1f)
+    {
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    }
+    else if (exponent == 0)
+    {
+        if (mantissa == 0)
+        {
+            bits = sign;
+        }
+        else
+        {
+            //Subnormal, shift the mantissa up until its leading one is the implicit bit
+            int shift = 0;
+            while ((mantissa & 0x400) == 0)
+            {
+                mantissa <<= 1;
+                shift++;
+            }
+            bits = sign | ((unsigned int)(127 - 15 + 1 - shift) << 23) | ((mantissa & 0x3ff) << 13);
+        }
+    }
+    else
+    {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+
+
+/**
+* \brief Normalizes samples from minValue - maxValue into 0 - 1, clamps, and writes them in the format. \n
+* The format is picked once outside the loops, so each loop is a plain branch free conversion the
+* compiler can vectorize, clamping with std::min and std::max. The unorm loops clamp after scaling so
+* nothing follows the clamp but the conversion. Meant to be called per row from inside a generation
+* loop so a full float copy of the map never exists.
+* \param values Samples to convert
+* \param count Amount of samples
+* \param minValue Value written as 0
+* \param maxValue Value written as 1
+* \param format Format to write
+* \param out count samples of the format
+*/
+inline void QuantizeSamples(const float* values, size_t count, float minValue, float maxValue,
+    QuantizedFormat_t format, void* out)
+{
+    const float range = maxValue - minValue;
+    const float inverseRange = (range != 0) ? 1.0f / range : 0.0f;
+    size_t i = 0;
+
+    switch (format)
+    {
+    case Quantized_Format_Unorm8:
+    {
+        unsigned char* target = (unsigned char*)out;
+        for (i = 0; i < count; i++)
+        {
+            const float t = (values[i] - minValue) * inverseRange;
+            target[i] = (unsigned char)std::min(std::max(t * 255.0f + 0.5f, 0.5f), 255.5f);
+        }
+        break;
+    }
+
+    case Quantized_Format_Unorm16:
+    {
+        unsigned short* target = (unsigned short*)out;
+        for (i = 0; i < count; i++)
+        {
+            const float t = (values[i] - minValue) * inverseRange;
+            target[i] = (unsigned short)std::min(std::max(t * 65535.0f + 0.5f, 0.5f), 65535.5f);
+        }
+        break;
+    }
+
+    default:
+    {
+        unsigned short* target = (unsigned short*)out;
+        for (i = 0; i < count; i++)
+        {
+            //Clamped on the bits, as a float clamp here is compiled to branches. Positive floats order like
+            //their bits, so negatives write 0 and NaN writes 1
+            float t = (values[i] - minValue) * inverseRange;
+            int bits;
+            memcpy(&bits, &t, sizeof(bits));
+            bits = std::min(std::max(bits, 0), 0x3f800000);
+            memcpy(&t, &bits, sizeof(t));
+            target[i] = FloatToHalf(t);
+        }
+        break;
+    }
+    }
+}
+
+
+
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * @file gquantize.h
+ * @brief Header file for writing noise straight into 8 bit, 16 bit and half float samples
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GQUANTIZE_H_INCLUDED
+#define GQUANTIZE_H_INCLUDED
+
+#include <stddef.h>
+#include <string.h>
+#include <algorithm>
+
+
+/**
+ * @brief Sample formats a map can be written in
+ */
+typedef enum QuantizedFormats {
+
+    ///unsigned char, 0 - 255 for 0 - 1
+    Quantized_Format_Unorm8,
+
+    ///unsigned short, 0 - 65535 for 0 - 1
+    Quantized_Format_Unorm16,
+
+    ///IEEE 754 half float bits in an unsigned short, holding 0 - 1
+    Quantized_Format_Half
+
+} QuantizedFormat_t;
+
+
+inline size_t QuantizedFormatBytes(QuantizedFormat_t format);
+inline unsigned short FloatToHalf(float value);
+inline float HalfToFloat(unsigned short value);
+inline void QuantizeSamples(const float* values, size_t count, float minValue, float maxValue,
+    QuantizedFormat_t format, void* out);
+
+
+
+
+#include "gquantize.cpp"
+
+
+#endif // GQUANTIZE_H_INCLUDED
@@ -187,6 +187,46 @@ T wyhash(T value) {
 
 
 
+/**
+ * @brief Hashes a seed and 2D lattice coordinates into a random value, without any state. \n
+ * The coordinates are spread by large odd constants and mixed with AdaptedLehmer32,
+ * using only integer multiplies, shifts and xors.
+ *
+ *
+ * @param seed The seed to hash with
+ * @param x The x lattice coordinate
+ * @param y The y lattice coordinate
+ * @return The random value
+ */
+template<typename T>
+T HashCoordinates2D(T seed, int x, int y) {
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    unsigned int h = (unsigned int)seed ^ ((unsigned int)x * 0x27d4eb2du) ^ ((unsigned int)y * 0x165667b1u);
+    return (T)AdaptedLehmer32<unsigned int>(h);
+}
+
+
+
+/**
+ * @brief Hashes a seed and 3D lattice coordinates into a random value, without any state
+ *
+ *
+ * @param seed The seed to hash with
+ * @param x The x lattice coordinate
+ * @param y The y lattice coordinate
+ * @param z The z lattice coordinate
+ * @return The random value
+ */
+template<typename T>
+T HashCoordinates3D(T seed, int x, int y, int z) {
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    unsigned int h = (unsigned int)seed ^ ((unsigned int)x * 0x27d4eb2du) ^ ((unsigned int)y * 0x165667b1u) ^
+        ((unsigned int)z * 0x9e3779b1u);
+    return (T)AdaptedLehmer32<unsigned int>(h);
+}
+
+
+
 
 
 #endif
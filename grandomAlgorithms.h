@@ -50,6 +50,14 @@ T AdaptedLehmer32(T value);
 template<typename T>
 T wyhash(T value);
 
+
+template<typename T>
+T HashCoordinates2D(T seed, int x, int y);
+
+
+template<typename T>
+T HashCoordinates3D(T seed, int x, int y, int z);
+
 #include "grandomAlgorithms.cpp"
 
 #endif // GRANDOMALGORITHMS_H_INCLUDED
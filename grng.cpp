@@ -20,7 +20,8 @@
 
 
 /// <summary>
-/// The permutation table from ken perlins noise source code
+/// The permutation table from ken perlins noise source code, repeated once so
+/// the chained lookups of ImprovedNoise (indices up to 511) never need wrapping
 /// </summary>
 /// <value></value>
 static const int PermutationTable[] = {
@@ -37,7 +38,19 @@ static const int PermutationTable[] = {
     251,34,242,193,238,210,144,12,191,179,162,241, 81,51,145,235,249,14,239,107,
     49,192,214, 31,181,199,106,157,184, 84,204,176,115,121,50,45,127, 4,150,254,
     138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180,
-    151
+    151,160,137,91,90,15,
+    131,13,201,95,96,53,194,233,7,225,140,36,103,30,69,142,8,99,37,240,21,10,23,
+    190, 6,148,247,120,234,75,0,26,197,62,94,252,219,203,117,35,11,32,57,177,33,
+    88,237,149,56,87,174,20,125,136,171,168, 68,175,74,165,71,134,139,48,27,166,
+    77,146,158,231,83,111,229,122,60,211,133,230,220,105,92,41,55,46,245,40,244,
+    102,143,54, 65,25,63,161, 1,216,80,73,209,76,132,187,208, 89,18,169,200,196,
+    135,130,116,188,159,86,164,100,109,198,173,186, 3,64,52,217,226,250,124,123,
+    5,202,38,147,118,126,255,82,85,212,207,206,59,227,47,16,58,17,182,189,28,42,
+    223,183,170,213,119,248,152, 2,44,154,163, 70,221,153,101,155,167, 43,172,9,
+    129,22,39,253, 19,98,108,110,79,113,224,232,178,185, 112,104,218,246,97,228,
+    251,34,242,193,238,210,144,12,191,179,162,241, 81,51,145,235,249,14,239,107,
+    49,192,214, 31,181,199,106,157,184, 84,204,176,115,121,50,45,127, 4,150,254,
+    138,236,205,93,222,114,67,29,24,72,243,141,128,195,78,66,215,61,156,180
 };
 
 
@@ -56,6 +69,305 @@ static double FadeDouble(double t)  {
 
 
 
+/// <summary>
+/// Derivative of the fade curve, 30t^2(t-1)^2
+/// </summary>
+static float FadeDerivativeFloat(float t) {
+    return (30*t*t*(t*(t-2)+1));
+}
+
+
+
+static double FadeDerivativeDouble(double t) {
+    return (30*t*t*(t*(t-2)+1));
+}
+
+
+
+/// <summary>
+/// Gradient direction tables, one load per lattice corner instead of picking axes and signs with branches. \n
+/// Rows are indexed by hash & 31 and padded to 2 or 4 components so each row is aligned. The classic set
+/// repeats the original Perlin directions in the order the hash bits used to select them, so it gives the
+/// same results as the branching code did. The extended set spreads 32 directions of the same length evenly
+/// around the circle and over the sphere. The 4D rows are the 32 tesseract edge midpoints simplex noise uses.
+/// </summary>
+template<typename Real>
+struct GradientTables {
+    alignas(16) static const Real Directions2D[2][32][2];
+    alignas(16) static const Real Directions3D[2][32][4];
+    alignas(16) static const Real Directions4D[32][4];
+};
+
+
+
+template<typename Real>
+alignas(16) const Real GradientTables<Real>::Directions2D[2][32][2] = {
+    {
+        { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 },
+        { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 },
+        { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 },
+        { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }
+    },
+    {
+        { 1.40740374, 0.13861717 }, { 1.35331800, 0.41052453 }, { 1.24722501, 0.66665566 }, { 1.09320187, 0.89716759 },
+        { 0.89716759, 1.09320187 }, { 0.66665566, 1.24722501 }, { 0.41052453, 1.35331800 }, { 0.13861717, 1.40740374 },
+        { -0.13861717, 1.40740374 }, { -0.41052453, 1.35331800 }, { -0.66665566, 1.24722501 }, { -0.89716759, 1.09320187 },
+        { -1.09320187, 0.89716759 }, { -1.24722501, 0.66665566 }, { -1.35331800, 0.41052453 }, { -1.40740374, 0.13861717 },
+        { -1.40740374, -0.13861717 }, { -1.35331800, -0.41052453 }, { -1.24722501, -0.66665566 }, { -1.09320187, -0.89716759 },
+        { -0.89716759, -1.09320187 }, { -0.66665566, -1.24722501 }, { -0.41052453, -1.35331800 }, { -0.13861717, -1.40740374 },
+        { 0.13861717, -1.40740374 }, { 0.41052453, -1.35331800 }, { 0.66665566, -1.24722501 }, { 0.89716759, -1.09320187 },
+        { 1.09320187, -0.89716759 }, { 1.24722501, -0.66665566 }, { 1.35331800, -0.41052453 }, { 1.40740374, -0.13861717 }
+    }
+};
+
+
+
+template<typename Real>
+alignas(16) const Real GradientTables<Real>::Directions3D[2][32][4] = {
+    {
+        { 1, 1, 0, 0 }, { -1, 1, 0, 0 }, { 1, -1, 0, 0 }, { -1, -1, 0, 0 },
+        { 1, 0, 1, 0 }, { -1, 0, 1, 0 }, { 1, 0, -1, 0 }, { -1, 0, -1, 0 },
+        { 0, 1, 1, 0 }, { 0, -1, 1, 0 }, { 0, 1, -1, 0 }, { 0, -1, -1, 0 },
+        { 1, 1, 0, 0 }, { 0, -1, 1, 0 }, { -1, 1, 0, 0 }, { 0, -1, -1, 0 },
+        { 1, 1, 0, 0 }, { -1, 1, 0, 0 }, { 1, -1, 0, 0 }, { -1, -1, 0, 0 },
+        { 1, 0, 1, 0 }, { -1, 0, 1, 0 }, { 1, 0, -1, 0 }, { -1, 0, -1, 0 },
+        { 0, 1, 1, 0 }, { 0, -1, 1, 0 }, { 0, 1, -1, 0 }, { 0, -1, -1, 0 },
+        { 1, 1, 0, 0 }, { 0, -1, 1, 0 }, { -1, 1, 0, 0 }, { 0, -1, -1, 0 }
+    },
+    {
+        { 0.35078038, 0.00000000, 1.37001939, 0 }, { -0.44083429, 0.40384032, 1.28163104, 0 },
+        { 0.06636136, -0.75615345, 1.19324269, 0 }, { 0.53711640, 0.70057323, 1.10485435, 0 },
+        { -0.96822770, -0.17126585, 1.01646600, 0 }, { 0.90035920, -0.57273483, 0.92807765, 0 },
+        { -0.29541577, 1.09893194, 0.83968930, 0 }, { -0.55223257, -1.06329021, 0.75130096, 0 },
+        { 1.17341755, 0.42853021, 0.66291261, 0 }, { -1.19448977, 0.49306801, 0.57452426, 0 },
+        { 0.56288150, -1.20284508, 0.48613591, 0 }, { 0.40616656, 1.29492301, 0.39774756, 0 },
+        { -1.19395914, -0.69192373, 0.30935922, 0 }, { 1.36426324, -0.29992945, 0.22097087, 0 },
+        { -0.80977363, 1.15181966, 0.13258252, 0 }, { -0.18165280, -1.40180210, 0.04419417, 0 },
+        { 1.08084883, 0.91094054, -0.04419417, 0 }, { -1.40678270, 0.05817488, -0.13258252, 0 },
+        { 0.99012379, -0.98530541, -0.22097087, 0 }, { -0.06374247, 1.37848967, -0.30935922, 0 },
+        { -0.86952443, -1.04198087, -0.39774756, 0 }, { 1.31617297, 0.17708921, -0.48613591, 0 },
+        { -1.06075794, 0.73804774, -0.57452426, 0 }, { 0.27418019, -1.21875843, -0.66291261, 0 },
+        { 0.59569383, 1.03956517, -0.75130096, 0 }, { -1.08411326, -0.34586170, -0.83968930, 0 },
+        { 0.96869093, -0.44755978, -0.92807765, 0 }, { -0.37959776, 0.90702945, -1.01646600, 0 },
+        { -0.29877820, -0.83067952, -1.10485435, 0 }, { 0.67191177, 0.35313800, -1.19324269, 0 },
+        { -0.57810080, 0.15238551, -1.28163104, 0 }, { 0.18971527, -0.29505083, -1.37001939, 0 }
+    }
+};
+
+
+
+template<typename Real>
+alignas(16) const Real GradientTables<Real>::Directions4D[32][4] = {
+    { 0, 1, 1, 1 }, { 0, 1, 1, -1 }, { 0, 1, -1, 1 }, { 0, 1, -1, -1 },
+    { 0, -1, 1, 1 }, { 0, -1, 1, -1 }, { 0, -1, -1, 1 }, { 0, -1, -1, -1 },
+    { 1, 0, 1, 1 }, { 1, 0, 1, -1 }, { 1, 0, -1, 1 }, { 1, 0, -1, -1 },
+    { -1, 0, 1, 1 }, { -1, 0, 1, -1 }, { -1, 0, -1, 1 }, { -1, 0, -1, -1 },
+    { 1, 1, 0, 1 }, { 1, 1, 0, -1 }, { 1, -1, 0, 1 }, { 1, -1, 0, -1 },
+    { -1, 1, 0, 1 }, { -1, 1, 0, -1 }, { -1, -1, 0, 1 }, { -1, -1, 0, -1 },
+    { 1, 1, 1, 0 }, { 1, 1, -1, 0 }, { 1, -1, 1, 0 }, { 1, -1, -1, 0 },
+    { -1, 1, 1, 0 }, { -1, 1, -1, 0 }, { -1, -1, 1, 0 }, { -1, -1, -1, 0 }
+};
+
+
+
+/// <summary>
+/// The gradient vector FloatGradient2D dots with, (+-1, +-1) in the classic set, from the table of the real type
+/// </summary>
+template<typename Real>
+static inline void GradientVector2D(int hash, Real* gradient, GradientSet_t gradientSet = Gradient_Set_Classic) {
+    const Real* direction = GradientTables<Real>::Directions2D[gradientSet][hash & 31];
+    gradient[0] = direction[0];
+    gradient[1] = direction[1];
+}
+
+
+
+/// <summary>
+/// The gradient vector FloatGradient3D and DoubleGradient dot with, one of the 12 cube edge directions in the classic set
+/// </summary>
+template<typename Real>
+static inline void GradientVector3D(int hash, Real* gradient, GradientSet_t gradientSet = Gradient_Set_Classic) {
+    const Real* direction = GradientTables<Real>::Directions3D[gradientSet][hash & 31];
+    gradient[0] = direction[0];
+    gradient[1] = direction[1];
+    gradient[2] = direction[2];
+}
+
+
+
+/// <summary>
+/// Wraps a lattice index into 0 - (period - 1), negative indices included
+/// </summary>
+static inline int WrapIndex(int value, int period) {
+    int wrapped = value % period;
+    return (wrapped < 0) ? wrapped + period : wrapped;
+}
+
+
+
+/// <summary>
+/// Gradient hash of a wrapped lattice cell for periods longer than the 256 entry permutation table. \n
+/// Hashed with a fixed seed so, like the table, it reads no generator state and never repeats early.
+/// </summary>
+static inline int PeriodicLatticeHash2D(int x, int y) {
+    return (int)(HashCoordinates2D<unsigned int>(0u, x, y) >> 24);
+}
+
+
+
+static inline int PeriodicLatticeHash3D(int x, int y, int z) {
+    return (int)(HashCoordinates3D<unsigned int>(0u, x, y, z) >> 24);
+}
+
+
+
+/// <summary>
+/// Floors to an int without going through std::floor
+/// </summary>
+/// <param name="value"></param>
+/// <returns></returns>
+static inline int FastFloorToInt(float value) {
+    int truncated = (int)value;
+    return (value < truncated) ? truncated - 1 : truncated;
+}
+
+
+
+/// <summary>
+/// Floors to an int for each real type the noise kernels run on. \n
+/// Truncates and subtracts the comparison rather than selecting, so loops over the kernels stay branch free.
+/// </summary>
+static inline int RealFloorToInt(float value) {
+    const int truncated = (int)value;
+    return truncated - (value < (float)truncated);
+}
+
+
+
+static inline int RealFloorToInt(double value) {
+    const int truncated = (int)value;
+    return truncated - (value < (double)truncated);
+}
+
+
+
+static inline int RealFloorToInt(Fixed16_t value) {
+    return value.Floor();
+}
+
+
+
+/// <summary>
+/// The fade curve, 6t^5 - 15t^4 + 10t^3, for any real type
+/// </summary>
+template<typename Real>
+static inline Real FadeReal(Real t) {
+    return (t*t*t*(t*(t*Real(6)-Real(15))+Real(10)));
+}
+
+
+
+template<typename Real>
+static inline Real LerpReal(Real a, Real b, Real t) {
+    return (b - a) * t + a;
+}
+
+
+
+/// <summary>
+/// Integer type the lattice of each real type indexes its tables with. \n
+/// gcc only gathers doubles through 64 bit indices, so double lattices index with long long to keep their
+/// batch loops vectorized, while float keeps int and its eight lanes.
+/// </summary>
+template<typename Real>
+struct LatticeIndex {
+    typedef int Type;
+};
+
+
+
+template<>
+struct LatticeIndex<double> {
+    typedef long long Type;
+};
+
+
+
+/// <summary>
+/// FloatGradient2D and FloatGradient3D for any real type, a table load and a dot product. \n
+/// Fixed16_t keeps the sign flip and add form, the classic directions only, so it stays exact in fixed point.
+/// </summary>
+template<typename Real>
+static inline Real RealGradient2D(typename LatticeIndex<Real>::Type hash, Real x, Real y, GradientSet_t gradientSet = Gradient_Set_Classic) {
+    hash &= 31;
+    return GradientTables<Real>::Directions2D[gradientSet][hash][0] * x + GradientTables<Real>::Directions2D[gradientSet][hash][1] * y;
+}
+
+
+
+template<typename Real>
+static inline Real RealGradient3D(typename LatticeIndex<Real>::Type hash, Real x, Real y, Real z, GradientSet_t gradientSet = Gradient_Set_Classic) {
+    hash &= 31;
+    return GradientTables<Real>::Directions3D[gradientSet][hash][0] * x + GradientTables<Real>::Directions3D[gradientSet][hash][1] * y
+        + GradientTables<Real>::Directions3D[gradientSet][hash][2] * z;
+}
+
+
+
+template<>
+inline Fixed16_t RealGradient2D<Fixed16_t>(int hash, Fixed16_t x, Fixed16_t y, GradientSet_t) {
+    return ((hash & 1) == 0 ? x : -x) + ((hash & 2) == 0 ? y : -y);
+}
+
+
+
+template<>
+inline Fixed16_t RealGradient3D<Fixed16_t>(int hash, Fixed16_t x, Fixed16_t y, Fixed16_t z, GradientSet_t) {
+    int h = hash & 15;
+    Fixed16_t u = h<8 ? x : y,
+            v = h<4 ? y : h==12||h==14 ? x : z;
+    return ((h&1) == 0 ? u : -u) + ((h&2) == 0 ? v : -v);
+}
+
+
+
+/// <summary>
+/// Picks the octaves of a fractal sum worth evaluating. \n
+/// An octave is dropped when it has more than half a cycle per sample, above the Nyquist limit it
+/// only adds aliasing. The loop stops once the amplitude of every remaining octave together falls
+/// below amplitudeEpsilon. At least one octave, the coarsest, is always kept.
+/// </summary>
+/// <param name="cyclesPerSample">Lattice cells crossed per sample step, per octave</param>
+/// <param name="amplitudes">Amplitude per octave</param>
+/// <param name="octaveAmount"></param>
+/// <param name="amplitudeEpsilon">Zero keeps every octave below the Nyquist limit</param>
+/// <param name="keptOctaves">Receives the indices of the kept octaves, octaveAmount long</param>
+/// <returns>The amount of kept octaves</returns>
+static int SelectVisibleOctaves(const float* cyclesPerSample, const float* amplitudes, int octaveAmount,
+    float amplitudeEpsilon, int* keptOctaves) {
+    float remainingAmplitude = 0;
+    int coarsest = 0;
+    int keptAmount = 0;
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        remainingAmplitude += std::fabs(amplitudes[i]);
+        if (std::fabs(cyclesPerSample[i]) < std::fabs(cyclesPerSample[coarsest])) coarsest = i;
+    }
+
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        if (remainingAmplitude < amplitudeEpsilon) break;
+        remainingAmplitude -= std::fabs(amplitudes[i]);
+        if (std::fabs(cyclesPerSample[i]) <= 0.5f) keptOctaves[keptAmount++] = i;
+    }
+
+    if (keptAmount == 0) keptOctaves[keptAmount++] = coarsest;
+    return keptAmount;
+}
+
+
+
 static float Clamp01(float value ) {
     if( value < 0.f ) value = 0.f;
     if( value > 1.f ) value = 1.f;
@@ -79,7 +391,7 @@ static float Clamp(float value, float minValue, float maxValue) {
 
 
 static float InverseLerpClamped( float a, float b, float value ) {
-    return Clamp(( value - a ) / ( b - a ),a,b );
+    return Clamp01(( value - a ) / ( b - a ));
 }
 
 
@@ -163,6 +475,7 @@ template<typename T>
 grng<T>::grng()
 {
     static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_udtGradientSet = Gradient_Set_Classic;
     selectedAlgorithm = 0;
     m_gdtSeed = 0;
     m_gdtSeed |= 6256256;
@@ -181,6 +494,7 @@ grng<T>::grng(grng<U> grngtoCopy)
 {
     static_assert(std::is_integral<U>::value, "U must be an integral numbers. Howd you initialize a class without that?");
     m_gdtSeed = grngtoCopy.GetSeed();
+    m_udtGradientSet = grngtoCopy.GetGradientSet();
     SetAlgorithm(grngtoCopy.GetAlgorithm());
 }
 
@@ -193,6 +507,7 @@ template<typename T>
 grng<T>::grng(const T newSeed)
 {
     static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_udtGradientSet = Gradient_Set_Classic;
     m_gdtSeed = newSeed;
     m_udtAlgorithmSelection = Random_Algorithm_AdaptedLehmer32;
     selectedAlgorithm = AdaptedLehmer32;
@@ -207,6 +522,7 @@ template<typename T>
 grng<T>::grng(const T newSeed, AlgorithmChoice_t algorithmSelection)
 {
     static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_udtGradientSet = Gradient_Set_Classic;
     m_gdtSeed = newSeed;
 
     
@@ -222,6 +538,7 @@ grng<T>::grng(const T newSeed, AlgorithmChoice_t algorithmSelection)
 template<typename T>
 grng<T>::grng(const char* seedPointer)
 {
+    m_udtGradientSet = Gradient_Set_Classic;
     selectedAlgorithm = 0;
     m_gdtSeed = 0;
     
@@ -247,6 +564,7 @@ grng<T>::grng(const char* seedPointer)
 template<typename T>
 grng<T>::grng(const char* seedPointer, AlgorithmChoice_t algorithmSelection)
 {
+    m_udtGradientSet = Gradient_Set_Classic;
     selectedAlgorithm = 0;
     m_gdtSeed = 0;
 
@@ -271,6 +589,7 @@ grng<T>::grng(const char* seedPointer, AlgorithmChoice_t algorithmSelection)
 template<typename T>
 grng<T>::grng(const std::string seedString)
 {
+    m_udtGradientSet = Gradient_Set_Classic;
     //Declare a hasher for hashing the string
     std::hash<std::string> seedHasher;
 
@@ -294,6 +613,7 @@ grng<T>::grng(const std::string seedString)
 template<typename T>
 grng<T>::grng(const std::string seedString, AlgorithmChoice_t algorithmSelection)
 {
+    m_udtGradientSet = Gradient_Set_Classic;
     //Declare a hasher for hashing the string
     std::hash<std::string> seedHasher;
 
@@ -330,6 +650,7 @@ void grng<T>::operator=(const grng<T> otherGrng)
 {
     m_gdtSeed = otherGrng.GetSeed();
     SetAlgorithm(otherGrng.GetAlgorithm());
+    m_udtGradientSet = otherGrng.m_udtGradientSet;
 }
 
 
@@ -1109,7 +1430,7 @@ float grng<T>::Perlin1D(float x) {
     int newX = (int)std::floor(x) & 0xff;
     x -= (int)std::floor(x);
     float fadedX = FadeFloat(x);
-    return CbFloatLerp(fadedX, FloatGradient(PermutationTable[newX],x),FloatGradient(PermutationTable[newX+1],x-1))*2;
+    return CbFloatLerp(FloatGradient(PermutationTable[newX],x),FloatGradient(PermutationTable[newX+1],x-1), fadedX)*2;
 }
 
 
@@ -1123,19 +1444,7 @@ float grng<T>::Perlin1D(float x) {
 /// <returns></returns>
 template<typename T>
 float grng<T>::Perlin2D(float x, float y) {
-    int newX = (int)std::floor(x) & 0xff;
-    int newY = (int)std::floor(y) & 0xff;
-    x -=(int)std::floor(x);
-    y -= (int)std::floor(y);
-    float fadedX = FadeFloat(x);
-    float fadedY = FadeFloat(y);
-    int A = (PermutationTable[newX] + newY) & 0xff;
-    int B = (PermutationTable[newX + 1] + newY) & 0xff;
-
-    float l1 = CbFloatLerp(fadedY, CbFloatLerp(fadedX, FloatGradient2D(PermutationTable[A],x,y),FloatGradient2D(PermutationTable[B], x-1,y)),
-        CbFloatLerp(fadedX, FloatGradient2D(PermutationTable[A+1],x,y-1), FloatGradient2D(PermutationTable[B+1], x-1, y-1)));
-
-    return l1;
+    return PerlinKernel2D<float>(x, y);
 }
 
 
@@ -1150,178 +1459,1188 @@ float grng<T>::Perlin2D(float x, float y) {
 /// <returns></returns>
 template<typename T>
 float grng<T>::Perlin3D(float x, float y, float z) {
-
-    int newX = (int)std::floor(x) & 0xff;
-    int newY = (int)std::floor(y) & 0xff;
-    int newZ = (int)std::floor(z) & 0xff;
-    x -= (int)std::floor(x);
-    y -= (int)std::floor(y);
-    z -= (int)std::floor(y);
-    float fadedX = FadeFloat(x);
-    float fadedY = FadeFloat(y);
-    float fadedZ = FadeFloat(z);
-
-    int A = (PermutationTable[newX] + newY) & 0xff;
-    int B = (PermutationTable[newX + 1] + newY) & 0xff;
-    int AA = (PermutationTable[A] + newZ) & 0xff;
-    int BA = (PermutationTable[B] + newZ) & 0xff;
-    int AB = (PermutationTable[A+1] + newZ) & 0xff;
-    int BB = (PermutationTable[B+1] + newZ) & 0xff;
-
-    float l1 = CbFloatLerp(fadedZ, CbFloatLerp(fadedY, CbFloatLerp(fadedX, FloatGradient3D(PermutationTable[AA], x  , y  , z   ),
-        FloatGradient3D(PermutationTable[BA], x-1, y  , z   )),
-        CbFloatLerp(fadedX, FloatGradient3D(PermutationTable[AB], x  , y-1, z   ),
-        FloatGradient3D(PermutationTable[BB], x-1, y-1, z   ))),
-        CbFloatLerp(fadedY, CbFloatLerp(fadedX, FloatGradient3D(PermutationTable[AA+1], x  , y  , z-1 ),
-        FloatGradient3D(PermutationTable[BA+1], x-1, y  , z-1 )),
-        CbFloatLerp(fadedX, FloatGradient3D(PermutationTable[AB+1], x  , y-1, z-1 ),
-        FloatGradient3D(PermutationTable[BB+1], x-1, y-1, z-1 ))));
-
-    //Changed HERE
-    return l1;
+    return PerlinKernel3D<float>(x, y, z);
 }
 
 
 
 /// <summary>
-/// Ken perlins improved noise
+/// 2D Perlin Noise for any real type. \n
+/// The one implementation behind Perlin2D, instantiated for float, double or Fixed16_t. The fixed point
+/// version only uses integer math, so it gives the same bits on every compiler and platform.
 /// </summary>
 /// <param name="x"></param>
 /// <param name="y"></param>
-/// <param name="z"></param>
 /// <returns></returns>
 template<typename T>
-double grng<T>::ImprovedNoise(double x, double y) {
-
-
-    //var PermutationTable = CreatePermutationTable();
-    double z = 0.01;
-    x +=NextDouble();
-    y+=NextDouble();
-    z+=NextDouble();
-
-    // FIND UNIT CUBE THAT CONTAINS POINT.
-    int X = (int)std::floor(x) & 255;
-    int Y = (int)std::floor(y) & 255;
-    int Z = (int)std::floor(z) & 255;
-    x -= std::floor(x);                                // FIND RELATIVE X,Y,Z
-    y -= std::floor(y);                                // OF POINT IN CUBE.
-    z -= std::floor(z);
-    double u = std::floor(x);                                // COMPUTE FADE CURVES
-    double v = std::floor(y);                                // FOR EACH OF X,Y,Z.
-    double w = std::floor(z);
-
-    // HASH COORDINATES OF THE 8 CUBE CORNERS,
-    int A = PermutationTable[X  ]+Y, AA = PermutationTable[A]+Z, AB = PermutationTable[A+1]+Z;
-    int B = PermutationTable[X+1]+Y, BA = PermutationTable[B]+Z, BB = PermutationTable[B+1]+Z;
-    // AND ADD BLENDED RESULTS FROM  8 CORNERS OF CUBE
-    return CbDoubleLerp(w, CbDoubleLerp(v, CbDoubleLerp(u, DoubleGradient(PermutationTable[AA], x  , y  , z   ),
-        DoubleGradient(PermutationTable[BA], x-1, y  , z   )),
-        CbDoubleLerp(u, DoubleGradient(PermutationTable[AB], x  , y-1, z   ),
-        DoubleGradient(PermutationTable[BB], x-1, y-1, z   ))),
-        CbDoubleLerp(v, CbDoubleLerp(u, DoubleGradient(PermutationTable[AA+1], x  , y  , z-1 ),
-        DoubleGradient(PermutationTable[BA+1], x-1, y  , z-1 )),
-        CbDoubleLerp(u, DoubleGradient(PermutationTable[AB+1], x  , y-1, z-1 ),
-        DoubleGradient(PermutationTable[BB+1], x-1, y-1, z-1 ))));
+template<typename Real>
+Real grng<T>::PerlinKernel2D(Real x, Real y) {
+    const int cellX = RealFloorToInt(x);
+    const int cellY = RealFloorToInt(y);
+    return PerlinLattice2D<Real>(cellX, cellY, x - Real(cellX), y - Real(cellY));
 }
 
 
 
 /// <summary>
-/// Ken perlins improved noise
+/// 2D Perlin Noise from a lattice cell and the 0 - 1 position inside it. \n
+/// The cell is a 64 bit integer and only its low 8 bits are hashed, so the cell can be anywhere
+/// while the fractional work stays in Real at full precision.
 /// </summary>
-/// <param name="x"></param>
-/// <param name="y"></param>
-/// <param name="z"></param>
+/// <param name="cellX"></param>
+/// <param name="cellY"></param>
+/// <param name="x">Position inside the cell, 0 - 1</param>
+/// <param name="y">Position inside the cell, 0 - 1</param>
 /// <returns></returns>
 template<typename T>
-double grng<T>::ImprovedNoise(double x, double y, double z) {
+template<typename Real>
+Real grng<T>::PerlinLattice2D(long long cellX, long long cellY, Real x, Real y) {
+    typedef typename LatticeIndex<Real>::Type Index;
+    const Index newX = (Index)(cellX & 0xff);
+    const Index newY = (Index)(cellY & 0xff);
+    const Real one = Real(1);
+    Real fadedX = FadeReal(x);
+    Real fadedY = FadeReal(y);
+    Index A = (PermutationTable[newX] + newY) & 0xff;
+    Index B = (PermutationTable[newX + 1] + newY) & 0xff;
 
-
-    //var PermutationTable = CreatePermutationTable();
-
-    x +=NextDouble();
-    y+=NextDouble();
-    z+=NextDouble();
-
-    // FIND UNIT CUBE THAT CONTAINS POINT.
-    int X = (int)std::floor(x) & 255;
-    int Y = (int)std::floor(y) & 255;
-    int Z = (int)std::floor(z) & 255;
-    x -= std::floor(x);                                // FIND RELATIVE X,Y,Z
-    y -= std::floor(y);                                // OF POINT IN CUBE.
-    z -= std::floor(z);
-    double u = std::floor(x);                                // COMPUTE FADE CURVES
-    double v = std::floor(y);                                // FOR EACH OF X,Y,Z.
-    double w = std::floor(z);
-
-    // HASH COORDINATES OF THE 8 CUBE CORNERS,
-    int A = PermutationTable[X  ]+Y, AA = PermutationTable[A]+Z, AB = PermutationTable[A+1]+Z;
-    int B = PermutationTable[X+1]+Y, BA = PermutationTable[B]+Z, BB = PermutationTable[B+1]+Z;
-    // AND ADD BLENDED RESULTS FROM  8 CORNERS OF CUBE
-    return CbDoubleLerp(w, CbDoubleLerp(v, CbDoubleLerp(u, DoubleGradient(PermutationTable[AA], x  , y  , z   ),
-        DoubleGradient(PermutationTable[BA], x-1, y  , z   )),
-        CbDoubleLerp(u, DoubleGradient(PermutationTable[AB], x  , y-1, z   ),
-        DoubleGradient(PermutationTable[BB], x-1, y-1, z   ))),
-        CbDoubleLerp(v, CbDoubleLerp(u, DoubleGradient(PermutationTable[AA+1], x  , y  , z-1 ),
-        DoubleGradient(PermutationTable[BA+1], x-1, y  , z-1 )),
-        CbDoubleLerp(u, DoubleGradient(PermutationTable[AB+1], x  , y-1, z-1 ),
-        DoubleGradient(PermutationTable[BB+1], x-1, y-1, z-1 ))));
+    return LerpReal(LerpReal(RealGradient2D(PermutationTable[A], x, y, m_udtGradientSet), RealGradient2D(PermutationTable[B], x-one, y, m_udtGradientSet), fadedX),
+        LerpReal(RealGradient2D(PermutationTable[A+1], x, y-one, m_udtGradientSet), RealGradient2D(PermutationTable[B+1], x-one, y-one, m_udtGradientSet), fadedX), fadedY);
 }
 
 
 
-
 /// <summary>
-/// Returns gradient value
+/// 2D Perlin Noise with the corner gradients picked by hashing the seed and lattice coordinates
+/// instead of through PermutationTable. \n
+/// It never repeats within the int range of cells and needs no table, and each corner is an independent
+/// HashCoordinates2D of integer multiplies, shifts and xors rather than a chain of dependent loads, so the
+/// array form vectorizes. Same gradients and range as Perlin2D, different pattern, and it follows the seed.
 /// </summary>
-/// <param name="hash"></param>
 /// <param name="x"></param>
 /// <param name="y"></param>
 /// <returns></returns>
 template<typename T>
-float grng<T>::FloatGradient(int hash, float x) {
-    return ((hash&1) == 0 ? x : -x);
+float grng<T>::HashedPerlin2D(float x, float y) const {
+    float value;
+    HashedPerlin2D(&x, &y, &value, 1);
+    return value;
 }
 
 
 
-
-
 /// <summary>
-/// Returns gradient value
+/// 3D Perlin Noise with hashed corner gradients, see HashedPerlin2D. Same gradients and range as Perlin3D
 /// </summary>
-/// <param name="hash"></param>
 /// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
 /// <returns></returns>
 template<typename T>
-float grng<T>::FloatGradient2D(int hash, float x, float y) {
-    return ((hash & 1) == 0 ? x : -x) + ((hash & 2) == 0 ? y : -y);
+float grng<T>::HashedPerlin3D(float x, float y, float z) const {
+    float value;
+    HashedPerlin3D(&x, &y, &z, &value, 1);
+    return value;
 }
 
 
 
-
 /// <summary>
-/// Returns gradient value
+/// RealGradient2D and RealGradient3D written as bit selects and sign bit flips on the float bits instead of
+/// branches, for the hashed gradient loops. Same hash bits, same gradients, same results to the bit
 /// </summary>
-/// <param name="hash"></param>
-/// <param name="x"></param>
-/// <param name="y"></param>
-/// <param name="z"></param>
-/// <returns></returns>
-template<typename T>
-float grng<T>::FloatGradient3D(int hash, float x, float y, float z) {
-    int h = hash & 15;
-    float u = h<8 ? x : y,
-            v = h<4 ? y : h==12||h==14 ? x : z;
-    return ((h&1) == 0 ? u : -u) + ((h&2) == 0 ? v : -v);
+static inline unsigned int FloatToBits(float value) {
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
 }
 
 
 
-/// <summary>
-/// Returns gradient value
+static inline float BitsToFloat(unsigned int bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+
+
+static inline float BranchlessGradient2D(int hash, float x, float y) {
+    const unsigned int h = (unsigned int)hash;
+    return BitsToFloat(FloatToBits(x) ^ ((h & 1) << 31)) + BitsToFloat(FloatToBits(y) ^ ((h & 2) << 30));
+}
+
+
+
+static inline float BranchlessGradient3D(int hash, float x, float y, float z) {
+    const unsigned int h = (unsigned int)hash & 15;
+    const unsigned int xBits = FloatToBits(x);
+    const unsigned int yBits = FloatToBits(y);
+    const unsigned int zBits = FloatToBits(z);
+
+    //u is y from 8 up, v is y below 4 and x for 12 and 14, z otherwise
+    const unsigned int useYForU = 0u - ((h >> 3) & 1);
+    const unsigned int useYForV = (((h >> 2) | (h >> 3)) & 1) - 1u;
+    const unsigned int useXForV = 0u - ((h >> 3) & (h >> 2) & ~h & 1);
+    const unsigned int uBits = (yBits & useYForU) | (xBits & ~useYForU);
+    const unsigned int vBits = (yBits & useYForV) | (xBits & useXForV) | (zBits & ~(useYForV | useXForV));
+
+    return BitsToFloat(uBits ^ ((h & 1) << 31)) + BitsToFloat(vBits ^ ((h & 2) << 30));
+}
+
+
+
+/// <summary>
+/// Corner gradient of the hashed loops for a gradient set fixed at compile time. The classic set keeps the
+/// branchless bit selects, the extended set reads its direction table, a gather in the vectorized loop.
+/// </summary>
+template<GradientSet_t Set>
+static inline float HashedGradient2D(int hash, float x, float y) {
+    if (Set == Gradient_Set_Classic) return BranchlessGradient2D(hash, x, y);
+    return RealGradient2D<float>(hash, x, y, Set);
+}
+
+
+
+template<GradientSet_t Set>
+static inline float HashedGradient3D(int hash, float x, float y, float z) {
+    if (Set == Gradient_Set_Classic) return BranchlessGradient3D(hash, x, y, z);
+    return RealGradient3D<float>(hash, x, y, z, Set);
+}
+
+
+
+/// <summary>
+/// The HashedPerlin2D loop for one gradient set
+/// </summary>
+template<GradientSet_t Set>
+static void HashedPerlin2DLoop(unsigned int seed, const float* x, const float* y, float* out, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        int cellX = (int)x[i];
+        int cellY = (int)y[i];
+        cellX -= (x[i] < (float)cellX);
+        cellY -= (y[i] < (float)cellY);
+        const float fx = x[i] - (float)cellX;
+        const float fy = y[i] - (float)cellY;
+        const float fadedX = FadeFloat(fx);
+        const float fadedY = FadeFloat(fy);
+
+        const int h00 = (int)(HashCoordinates2D<unsigned int>(seed, cellX, cellY) >> 24);
+        const int h10 = (int)(HashCoordinates2D<unsigned int>(seed, cellX + 1, cellY) >> 24);
+        const int h01 = (int)(HashCoordinates2D<unsigned int>(seed, cellX, cellY + 1) >> 24);
+        const int h11 = (int)(HashCoordinates2D<unsigned int>(seed, cellX + 1, cellY + 1) >> 24);
+
+        out[i] = CbFloatLerp(CbFloatLerp(HashedGradient2D<Set>(h00, fx, fy), HashedGradient2D<Set>(h10, fx - 1.f, fy), fadedX),
+            CbFloatLerp(HashedGradient2D<Set>(h01, fx, fy - 1.f), HashedGradient2D<Set>(h11, fx - 1.f, fy - 1.f), fadedX), fadedY);
+    }
+}
+
+
+
+/// <summary>
+/// The HashedPerlin3D loop for one gradient set
+/// </summary>
+template<GradientSet_t Set>
+static void HashedPerlin3DLoop(unsigned int seed, const float* x, const float* y, const float* z, float* out, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        int cellX = (int)x[i];
+        int cellY = (int)y[i];
+        int cellZ = (int)z[i];
+        cellX -= (x[i] < (float)cellX);
+        cellY -= (y[i] < (float)cellY);
+        cellZ -= (z[i] < (float)cellZ);
+        const float fx = x[i] - (float)cellX;
+        const float fy = y[i] - (float)cellY;
+        const float fz = z[i] - (float)cellZ;
+        const float fadedX = FadeFloat(fx);
+        const float fadedY = FadeFloat(fy);
+        const float fadedZ = FadeFloat(fz);
+
+        const float n000 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX, cellY, cellZ) >> 24), fx, fy, fz);
+        const float n100 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX + 1, cellY, cellZ) >> 24), fx - 1.f, fy, fz);
+        const float n010 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX, cellY + 1, cellZ) >> 24), fx, fy - 1.f, fz);
+        const float n110 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX + 1, cellY + 1, cellZ) >> 24), fx - 1.f, fy - 1.f, fz);
+        const float n001 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX, cellY, cellZ + 1) >> 24), fx, fy, fz - 1.f);
+        const float n101 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX + 1, cellY, cellZ + 1) >> 24), fx - 1.f, fy, fz - 1.f);
+        const float n011 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX, cellY + 1, cellZ + 1) >> 24), fx, fy - 1.f, fz - 1.f);
+        const float n111 = HashedGradient3D<Set>((int)(HashCoordinates3D<unsigned int>(seed, cellX + 1, cellY + 1, cellZ + 1) >> 24), fx - 1.f, fy - 1.f, fz - 1.f);
+
+        out[i] = CbFloatLerp(CbFloatLerp(CbFloatLerp(n000, n100, fadedX), CbFloatLerp(n010, n110, fadedX), fadedY),
+            CbFloatLerp(CbFloatLerp(n001, n101, fadedX), CbFloatLerp(n011, n111, fadedX), fadedY), fadedZ);
+    }
+}
+
+
+
+/**
+* \brief HashedPerlin2D over arrays of coordinates, the gradient set picked once for the whole batch
+*/
+template<typename T>
+void grng<T>::HashedPerlin2D(const float* x, const float* y, float* out, size_t count) const {
+    const unsigned int seed = (unsigned int)m_gdtSeed;
+
+    if (m_udtGradientSet == Gradient_Set_Extended) HashedPerlin2DLoop<Gradient_Set_Extended>(seed, x, y, out, count);
+    else HashedPerlin2DLoop<Gradient_Set_Classic>(seed, x, y, out, count);
+}
+
+
+
+/**
+* \brief HashedPerlin3D over arrays of coordinates
+*/
+template<typename T>
+void grng<T>::HashedPerlin3D(const float* x, const float* y, const float* z, float* out, size_t count) const {
+    const unsigned int seed = (unsigned int)m_gdtSeed;
+
+    if (m_udtGradientSet == Gradient_Set_Extended) HashedPerlin3DLoop<Gradient_Set_Extended>(seed, x, y, z, out, count);
+    else HashedPerlin3DLoop<Gradient_Set_Classic>(seed, x, y, z, out, count);
+}
+
+
+
+/// <summary>
+/// Perlin2D over every pair of the x and y coordinates, out[row * width + column] = Perlin2D(x[column], y[row]). \n
+/// The floor, fraction and fade of each column are worked out once for the whole grid and those of a row once
+/// per row. Each row is then walked a lattice cell at a time: the corner hashes, gradient signs and the y half
+/// of the four dot products are set up once per run of columns sharing a cell, leaving four multiply adds and
+/// three lerps per sample. The result is bit identical to calling Perlin2D per sample.
+/// </summary>
+/// <param name="x">width column coordinates, usually ascending</param>
+/// <param name="width"></param>
+/// <param name="y">height row coordinates</param>
+/// <param name="height"></param>
+/// <param name="out">width * height samples, row major by y</param>
+template<typename T>
+void grng<T>::PerlinGrid2D(const float* x, int width, const float* y, int height, float* out)
+{
+    if (width <= 0 || height <= 0 || x == NULL || y == NULL || out == NULL) return;
+
+    std::vector<int> columnCells(width);
+    std::vector<float> columnFractions(width);
+    std::vector<float> columnFades(width);
+
+    for (int column = 0; column < width; column++)
+    {
+        const int cellX = RealFloorToInt(x[column]);
+        columnCells[column] = cellX & 0xff;
+        columnFractions[column] = x[column] - (float)cellX;
+        columnFades[column] = FadeReal(columnFractions[column]);
+    }
+
+    for (int row = 0; row < height; row++)
+    {
+        const int cellY = RealFloorToInt(y[row]);
+        const int newY = cellY & 0xff;
+        const float fractionY = y[row] - (float)cellY;
+        const float belowY = fractionY - 1.0f;
+        const float fadedY = FadeReal(fractionY);
+        float* line = out + (size_t)row * width;
+        int column = 0;
+
+        while (column < width)
+        {
+            const int newX = columnCells[column];
+            int runEnd = column + 1;
+            while (runEnd < width && columnCells[runEnd] == newX) runEnd++;
+
+            const int A = (PermutationTable[newX] + newY) & 0xff;
+            const int B = (PermutationTable[newX + 1] + newY) & 0xff;
+            const int h00 = PermutationTable[A];
+            const int h10 = PermutationTable[B];
+            const int h01 = PermutationTable[A + 1];
+            const int h11 = PermutationTable[B + 1];
+
+            float g00[2], g10[2], g01[2], g11[2];
+            GradientVector2D(h00, g00, m_udtGradientSet);
+            GradientVector2D(h10, g10, m_udtGradientSet);
+            GradientVector2D(h01, g01, m_udtGradientSet);
+            GradientVector2D(h11, g11, m_udtGradientSet);
+            const float signX00 = g00[0], signX10 = g10[0], signX01 = g01[0], signX11 = g11[0];
+            const float partY00 = g00[1] * fractionY;
+            const float partY10 = g10[1] * fractionY;
+            const float partY01 = g01[1] * belowY;
+            const float partY11 = g11[1] * belowY;
+
+            for (int i = column; i < runEnd; i++)
+            {
+                const float fractionX = columnFractions[i];
+                const float fadedX = columnFades[i];
+                const float n00 = signX00 * fractionX + partY00;
+                const float n10 = signX10 * (fractionX - 1.0f) + partY10;
+                const float n01 = signX01 * fractionX + partY01;
+                const float n11 = signX11 * (fractionX - 1.0f) + partY11;
+                line[i] = LerpReal(LerpReal(n00, n10, fadedX), LerpReal(n01, n11, fadedX), fadedY);
+            }
+
+            column = runEnd;
+        }
+    }
+}
+
+
+
+/// <summary>
+/// Perlin2D over a regular width * height grid, sample (column, row) at (startX + column * stepX, startY + row * stepY)
+/// </summary>
+template<typename T>
+void grng<T>::PerlinGrid2D(float startX, float startY, float stepX, float stepY, int width, int height, float* out)
+{
+    if (width <= 0 || height <= 0 || out == NULL) return;
+
+    std::vector<float> x(width), y(height);
+    for (int column = 0; column < width; column++) x[column] = startX + (float)column * stepX;
+    for (int row = 0; row < height; row++) y[row] = startY + (float)row * stepY;
+
+    PerlinGrid2D(&x[0], width, &y[0], height, out);
+}
+
+
+
+/// <summary>
+/// Adds one OffsetPerlinNoise2D octave over a grid to sum, sum[row * width + column] += (Perlin2D * 2 - 1) * amplitude. \n
+/// Same operations in the same order as the per sample octave loops, so the sums stay bit identical.
+/// </summary>
+template<typename T>
+void grng<T>::AccumulatePerlinGrid(const float* x, int width, const float* y, int height, float amplitude,
+    float* scratch, float* sum)
+{
+    const size_t count = (size_t)width * height;
+    PerlinGrid2D(x, width, y, height, scratch);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        float noise = scratch[i]*2-1;
+        sum[i] += (noise * amplitude);
+    }
+}
+
+
+
+/// <summary>
+/// 3D Perlin Noise for any real type, the one implementation behind Perlin3D and ImprovedNoise
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+template<typename Real>
+Real grng<T>::PerlinKernel3D(Real x, Real y, Real z) {
+    const int cellX = RealFloorToInt(x);
+    const int cellY = RealFloorToInt(y);
+    const int cellZ = RealFloorToInt(z);
+    return PerlinLattice3D<Real>(cellX, cellY, cellZ, x - Real(cellX), y - Real(cellY), z - Real(cellZ));
+}
+
+
+
+/// <summary>
+/// 3D Perlin Noise from a 64 bit lattice cell and the 0 - 1 position inside it
+/// </summary>
+/// <param name="cellX"></param>
+/// <param name="cellY"></param>
+/// <param name="cellZ"></param>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+template<typename Real>
+Real grng<T>::PerlinLattice3D(long long cellX, long long cellY, long long cellZ, Real x, Real y, Real z) {
+    typedef typename LatticeIndex<Real>::Type Index;
+    const Index newX = (Index)(cellX & 0xff);
+    const Index newY = (Index)(cellY & 0xff);
+    const Index newZ = (Index)(cellZ & 0xff);
+    const Real one = Real(1);
+    Real fadedX = FadeReal(x);
+    Real fadedY = FadeReal(y);
+    Real fadedZ = FadeReal(z);
+
+    Index A = (PermutationTable[newX] + newY) & 0xff;
+    Index B = (PermutationTable[newX + 1] + newY) & 0xff;
+    Index AA = (PermutationTable[A] + newZ) & 0xff;
+    Index BA = (PermutationTable[B] + newZ) & 0xff;
+    Index AB = (PermutationTable[A+1] + newZ) & 0xff;
+    Index BB = (PermutationTable[B+1] + newZ) & 0xff;
+
+    return LerpReal(LerpReal(LerpReal(RealGradient3D(PermutationTable[AA], x    , y    , z    , m_udtGradientSet),
+        RealGradient3D(PermutationTable[BA], x-one, y    , z    , m_udtGradientSet), fadedX),
+        LerpReal(RealGradient3D(PermutationTable[AB], x    , y-one, z    , m_udtGradientSet),
+        RealGradient3D(PermutationTable[BB], x-one, y-one, z    , m_udtGradientSet), fadedX), fadedY),
+        LerpReal(LerpReal(RealGradient3D(PermutationTable[AA+1], x    , y    , z-one, m_udtGradientSet),
+        RealGradient3D(PermutationTable[BA+1], x-one, y    , z-one, m_udtGradientSet), fadedX),
+        LerpReal(RealGradient3D(PermutationTable[AB+1], x    , y-one, z-one, m_udtGradientSet),
+        RealGradient3D(PermutationTable[BB+1], x-one, y-one, z-one, m_udtGradientSet), fadedX), fadedY), fadedZ);
+}
+
+
+
+/**
+* \brief PerlinKernel2D over arrays of coordinates. \n
+* A plain loop over the inlined kernel. Its floor and table loads are branch free, so float and double
+* batches vectorize at their own width with gathers and Fixed16_t batches stay in integer registers.
+*/
+template<typename T>
+template<typename Real>
+void grng<T>::PerlinKernel2D(const Real* x, const Real* y, Real* out, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = PerlinKernel2D<Real>(x[i], y[i]);
+    }
+}
+
+
+
+/**
+* \brief PerlinKernel3D over arrays of coordinates
+*/
+template<typename T>
+template<typename Real>
+void grng<T>::PerlinKernel3D(const Real* x, const Real* y, const Real* z, Real* out, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = PerlinKernel3D<Real>(x[i], y[i], z[i]);
+    }
+}
+
+
+
+/// <summary>
+/// 2D Perlin Noise at the world position origin + local, for worlds too large for float coordinates. \n
+/// The whole part of the local offset is folded into the 64 bit origin, so the fraction keeps full
+/// float precision however far the origin is from zero. Moving the origin by a whole number and the
+/// local offset back by the same amount returns the same value, so origins can be shifted freely.
+/// </summary>
+/// <param name="originX">Integer lattice origin</param>
+/// <param name="originY">Integer lattice origin</param>
+/// <param name="localX">Offset from the origin, best kept small</param>
+/// <param name="localY">Offset from the origin, best kept small</param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::Perlin2DLarge(long long originX, long long originY, float localX, float localY) {
+    const int wholeX = FastFloorToInt(localX);
+    const int wholeY = FastFloorToInt(localY);
+    return PerlinLattice2D<float>(originX + wholeX, originY + wholeY, localX - (float)wholeX, localY - (float)wholeY);
+}
+
+
+
+/// <summary>
+/// 3D Perlin Noise at the world position origin + local, for worlds too large for float coordinates
+/// </summary>
+/// <param name="originX"></param>
+/// <param name="originY"></param>
+/// <param name="originZ"></param>
+/// <param name="localX"></param>
+/// <param name="localY"></param>
+/// <param name="localZ"></param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::Perlin3DLarge(long long originX, long long originY, long long originZ, float localX, float localY, float localZ) {
+    const int wholeX = FastFloorToInt(localX);
+    const int wholeY = FastFloorToInt(localY);
+    const int wholeZ = FastFloorToInt(localZ);
+    return PerlinLattice3D<float>(originX + wholeX, originY + wholeY, originZ + wholeZ,
+        localX - (float)wholeX, localY - (float)wholeY, localZ - (float)wholeZ);
+}
+
+
+
+/**
+* \brief Perlin2DLarge for arrays of local offsets that share one origin, such as the samples of a chunk
+*/
+template<typename T>
+void grng<T>::Perlin2DLarge(long long originX, long long originY, const float* localX, const float* localY, float* out, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = Perlin2DLarge(originX, originY, localX[i], localY[i]);
+    }
+}
+
+
+
+/**
+* \brief Perlin3DLarge for arrays of local offsets that share one origin
+*/
+template<typename T>
+void grng<T>::Perlin3DLarge(long long originX, long long originY, long long originZ, const float* localX, const float* localY,
+    const float* localZ, float* out, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = Perlin3DLarge(originX, originY, originZ, localX[i], localY[i], localZ[i]);
+    }
+}
+
+
+
+/// <summary>
+/// Ken perlins improved noise
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+double grng<T>::ImprovedNoise(double x, double y) {
+
+
+    //var PermutationTable = CreatePermutationTable();
+    double z = 0.01;
+    x +=NextDouble();
+    y+=NextDouble();
+    z+=NextDouble();
+
+    // FIND UNIT CUBE THAT CONTAINS POINT.
+    int X = (int)std::floor(x) & 255;
+    int Y = (int)std::floor(y) & 255;
+    int Z = (int)std::floor(z) & 255;
+    x -= std::floor(x);                                // FIND RELATIVE X,Y,Z
+    y -= std::floor(y);                                // OF POINT IN CUBE.
+    z -= std::floor(z);
+    double u = FadeDouble(x);                                // COMPUTE FADE CURVES
+    double v = FadeDouble(y);                                // FOR EACH OF X,Y,Z.
+    double w = FadeDouble(z);
+
+    // HASH COORDINATES OF THE 8 CUBE CORNERS,
+    int A = PermutationTable[X  ]+Y, AA = PermutationTable[A]+Z, AB = PermutationTable[A+1]+Z;
+    int B = PermutationTable[X+1]+Y, BA = PermutationTable[B]+Z, BB = PermutationTable[B+1]+Z;
+    // AND ADD BLENDED RESULTS FROM  8 CORNERS OF CUBE
+    return CbDoubleLerp(CbDoubleLerp(CbDoubleLerp(DoubleGradient(PermutationTable[AA], x  , y  , z   ),
+        DoubleGradient(PermutationTable[BA], x-1, y  , z   ), u),
+        CbDoubleLerp(DoubleGradient(PermutationTable[AB], x  , y-1, z   ),
+        DoubleGradient(PermutationTable[BB], x-1, y-1, z   ), u), v),
+        CbDoubleLerp(CbDoubleLerp(DoubleGradient(PermutationTable[AA+1], x  , y  , z-1 ),
+        DoubleGradient(PermutationTable[BA+1], x-1, y  , z-1 ), u),
+        CbDoubleLerp(DoubleGradient(PermutationTable[AB+1], x  , y-1, z-1 ),
+        DoubleGradient(PermutationTable[BB+1], x-1, y-1, z-1 ), u), v), w);
+}
+
+
+
+/// <summary>
+/// Ken perlins improved noise
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+double grng<T>::ImprovedNoise(double x, double y, double z) {
+
+
+    //var PermutationTable = CreatePermutationTable();
+
+    x +=NextDouble();
+    y+=NextDouble();
+    z+=NextDouble();
+
+    return PerlinKernel3D<double>(x, y, z);
+}
+
+
+
+
+/// <summary>
+/// 2D Perlin Noise together with its analytic gradient. \n
+/// The value is computed exactly as Perlin2D, the gradient comes from the same corner
+/// gradients and the derivative of the fade curve, so no extra noise evaluations are needed.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <returns></returns>
+template<typename T>
+NoiseDerivative2D_t grng<T>::Perlin2DDerivative(float x, float y) {
+    int newX = (int)std::floor(x) & 0xff;
+    int newY = (int)std::floor(y) & 0xff;
+    x -= (int)std::floor(x);
+    y -= (int)std::floor(y);
+    float fadedX = FadeFloat(x);
+    float fadedY = FadeFloat(y);
+    float fadeDX = FadeDerivativeFloat(x);
+    float fadeDY = FadeDerivativeFloat(y);
+    int A = (PermutationTable[newX] + newY) & 0xff;
+    int B = (PermutationTable[newX + 1] + newY) & 0xff;
+
+    int h00 = PermutationTable[A], h10 = PermutationTable[B];
+    int h01 = PermutationTable[A+1], h11 = PermutationTable[B+1];
+    float n00 = FloatGradient2D(h00, x, y);
+    float n10 = FloatGradient2D(h10, x-1, y);
+    float n01 = FloatGradient2D(h01, x, y-1);
+    float n11 = FloatGradient2D(h11, x-1, y-1);
+
+    float g00[2], g10[2], g01[2], g11[2];
+    GradientVector2D(h00, g00, m_udtGradientSet);
+    GradientVector2D(h10, g10, m_udtGradientSet);
+    GradientVector2D(h01, g01, m_udtGradientSet);
+    GradientVector2D(h11, g11, m_udtGradientSet);
+
+    NoiseDerivative2D_t result;
+    result.value = CbFloatLerp(CbFloatLerp(n00, n10, fadedX), CbFloatLerp(n01, n11, fadedX), fadedY);
+
+    //Change of the blend weights plus the blended corner gradients
+    float k1 = n10 - n00;
+    float k2 = n01 - n00;
+    float k3 = n00 - n10 - n01 + n11;
+    result.dx = fadeDX * (k1 + k3 * fadedY) +
+        CbFloatLerp(CbFloatLerp(g00[0], g10[0], fadedX), CbFloatLerp(g01[0], g11[0], fadedX), fadedY);
+    result.dy = fadeDY * (k2 + k3 * fadedX) +
+        CbFloatLerp(CbFloatLerp(g00[1], g10[1], fadedX), CbFloatLerp(g01[1], g11[1], fadedX), fadedY);
+
+    return result;
+}
+
+
+
+/// <summary>
+/// 3D Perlin Noise together with its analytic gradient, value computed exactly as Perlin3D
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+NoiseDerivative3D_t grng<T>::Perlin3DDerivative(float x, float y, float z) {
+    int newX = (int)std::floor(x) & 0xff;
+    int newY = (int)std::floor(y) & 0xff;
+    int newZ = (int)std::floor(z) & 0xff;
+    x -= (int)std::floor(x);
+    y -= (int)std::floor(y);
+    z -= (int)std::floor(z);
+    float u = FadeFloat(x);
+    float v = FadeFloat(y);
+    float w = FadeFloat(z);
+    float du = FadeDerivativeFloat(x);
+    float dv = FadeDerivativeFloat(y);
+    float dw = FadeDerivativeFloat(z);
+
+    int A = (PermutationTable[newX] + newY) & 0xff;
+    int B = (PermutationTable[newX + 1] + newY) & 0xff;
+    int AA = (PermutationTable[A] + newZ) & 0xff;
+    int BA = (PermutationTable[B] + newZ) & 0xff;
+    int AB = (PermutationTable[A+1] + newZ) & 0xff;
+    int BB = (PermutationTable[B+1] + newZ) & 0xff;
+
+    int hashes[8] = {
+        PermutationTable[AA], PermutationTable[BA], PermutationTable[AB], PermutationTable[BB],
+        PermutationTable[AA+1], PermutationTable[BA+1], PermutationTable[AB+1], PermutationTable[BB+1]
+    };
+
+    float n[8];
+    float g[8][3];
+    for (int i = 0; i < 8; i++)
+    {
+        float cornerX = x - (float)(i & 1);
+        float cornerY = y - (float)((i >> 1) & 1);
+        float cornerZ = z - (float)((i >> 2) & 1);
+        n[i] = FloatGradient3D(hashes[i], cornerX, cornerY, cornerZ);
+        GradientVector3D(hashes[i], g[i], m_udtGradientSet);
+    }
+
+    NoiseDerivative3D_t result;
+    result.value = CbFloatLerp(CbFloatLerp(CbFloatLerp(n[0], n[1], u), CbFloatLerp(n[2], n[3], u), v),
+        CbFloatLerp(CbFloatLerp(n[4], n[5], u), CbFloatLerp(n[6], n[7], u), v), w);
+
+    float k1 = n[1] - n[0];
+    float k2 = n[2] - n[0];
+    float k3 = n[4] - n[0];
+    float k4 = n[0] - n[1] - n[2] + n[3];
+    float k5 = n[0] - n[2] - n[4] + n[6];
+    float k6 = n[0] - n[1] - n[4] + n[5];
+    float k7 = -n[0] + n[1] + n[2] - n[3] + n[4] - n[5] - n[6] + n[7];
+
+    float blended[3];
+    for (int axis = 0; axis < 3; axis++)
+    {
+        blended[axis] = CbFloatLerp(CbFloatLerp(CbFloatLerp(g[0][axis], g[1][axis], u), CbFloatLerp(g[2][axis], g[3][axis], u), v),
+            CbFloatLerp(CbFloatLerp(g[4][axis], g[5][axis], u), CbFloatLerp(g[6][axis], g[7][axis], u), v), w);
+    }
+
+    result.dx = du * (k1 + k4 * v + k6 * w + k7 * v * w) + blended[0];
+    result.dy = dv * (k2 + k5 * w + k4 * u + k7 * w * u) + blended[1];
+    result.dz = dw * (k3 + k6 * u + k5 * v + k7 * u * v) + blended[2];
+
+    return result;
+}
+
+
+
+/// <summary>
+/// Ken perlins improved noise together with its analytic gradient, at exactly the point given. \n
+/// Unlike ImprovedNoise it takes no random offset, so like Perlin3DDerivative it reads no generator
+/// state: the value matches PerlinKernel3D<double> and the gradient is that field's gradient.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+NoiseDerivative3DDouble_t grng<T>::ImprovedNoiseDerivative(double x, double y, double z) {
+
+    int X = (int)std::floor(x) & 255;
+    int Y = (int)std::floor(y) & 255;
+    int Z = (int)std::floor(z) & 255;
+    x -= std::floor(x);
+    y -= std::floor(y);
+    z -= std::floor(z);
+    double u = FadeDouble(x);
+    double v = FadeDouble(y);
+    double w = FadeDouble(z);
+    double du = FadeDerivativeDouble(x);
+    double dv = FadeDerivativeDouble(y);
+    double dw = FadeDerivativeDouble(z);
+
+    int A = PermutationTable[X  ]+Y, AA = PermutationTable[A]+Z, AB = PermutationTable[A+1]+Z;
+    int B = PermutationTable[X+1]+Y, BA = PermutationTable[B]+Z, BB = PermutationTable[B+1]+Z;
+
+    int hashes[8] = {
+        PermutationTable[AA], PermutationTable[BA], PermutationTable[AB], PermutationTable[BB],
+        PermutationTable[AA+1], PermutationTable[BA+1], PermutationTable[AB+1], PermutationTable[BB+1]
+    };
+
+    double n[8];
+    double g[8][3];
+    for (int i = 0; i < 8; i++)
+    {
+        double cornerX = x - (double)(i & 1);
+        double cornerY = y - (double)((i >> 1) & 1);
+        double cornerZ = z - (double)((i >> 2) & 1);
+        n[i] = DoubleGradient(hashes[i], cornerX, cornerY, cornerZ);
+        GradientVector3D(hashes[i], g[i], m_udtGradientSet);
+    }
+
+    NoiseDerivative3DDouble_t result;
+    result.value = CbDoubleLerp(CbDoubleLerp(CbDoubleLerp(n[0], n[1], u), CbDoubleLerp(n[2], n[3], u), v),
+        CbDoubleLerp(CbDoubleLerp(n[4], n[5], u), CbDoubleLerp(n[6], n[7], u), v), w);
+
+    double k1 = n[1] - n[0];
+    double k2 = n[2] - n[0];
+    double k3 = n[4] - n[0];
+    double k4 = n[0] - n[1] - n[2] + n[3];
+    double k5 = n[0] - n[2] - n[4] + n[6];
+    double k6 = n[0] - n[1] - n[4] + n[5];
+    double k7 = -n[0] + n[1] + n[2] - n[3] + n[4] - n[5] - n[6] + n[7];
+
+    double blended[3];
+    for (int axis = 0; axis < 3; axis++)
+    {
+        blended[axis] = CbDoubleLerp(CbDoubleLerp(CbDoubleLerp(g[0][axis], g[1][axis], u), CbDoubleLerp(g[2][axis], g[3][axis], u), v),
+            CbDoubleLerp(CbDoubleLerp(g[4][axis], g[5][axis], u), CbDoubleLerp(g[6][axis], g[7][axis], u), v), w);
+    }
+
+    result.dx = du * (k1 + k4 * v + k6 * w + k7 * v * w) + blended[0];
+    result.dy = dv * (k2 + k5 * w + k4 * u + k7 * w * u) + blended[1];
+    result.dz = dw * (k3 + k6 * u + k5 * v + k7 * u * v) + blended[2];
+
+    return result;
+}
+
+
+
+/// <summary>
+/// 2D Perlin Noise and its gradient over arrays of coordinates, written to separate value and gradient arrays
+/// </summary>
+template<typename T>
+void grng<T>::Perlin2DDerivative(const float* x, const float* y, float* value, float* dx, float* dy, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        NoiseDerivative2D_t sample = Perlin2DDerivative(x[i], y[i]);
+        value[i] = sample.value;
+        dx[i] = sample.dx;
+        dy[i] = sample.dy;
+    }
+}
+
+
+
+/// <summary>
+/// 3D Perlin Noise and its gradient over arrays of coordinates, written to separate value and gradient arrays
+/// </summary>
+template<typename T>
+void grng<T>::Perlin3DDerivative(const float* x, const float* y, const float* z, float* value,
+    float* dx, float* dy, float* dz, size_t count) {
+    for (size_t i = 0; i < count; i++)
+    {
+        NoiseDerivative3D_t sample = Perlin3DDerivative(x[i], y[i], z[i]);
+        value[i] = sample.value;
+        dx[i] = sample.dx;
+        dy[i] = sample.dy;
+        dz[i] = sample.dz;
+    }
+}
+
+
+
+/// <summary>
+/// 2D Perlin Noise that repeats every periodX along x and periodY along y. \n
+/// Lattice indices are wrapped by the period before they are hashed, so a tile sampled over exactly
+/// one period meets itself at the edges. Periods up to 256 go through the permutation table, and with
+/// both at 256 it matches Perlin2D. The table itself repeats every 256 cells, so longer periods hash
+/// the wrapped cells with PeriodicLatticeHash2D instead.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="periodX">Lattice cells before x repeats, at least 1</param>
+/// <param name="periodY">Lattice cells before y repeats, at least 1</param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::Perlin2DPeriodic(float x, float y, int periodX, int periodY) {
+    periodX = MAX(periodX, 1);
+    periodY = MAX(periodY, 1);
+    const int cellX = FastFloorToInt(x);
+    const int cellY = FastFloorToInt(y);
+    x -= (float)cellX;
+    y -= (float)cellY;
+    float fadedX = FadeFloat(x);
+    float fadedY = FadeFloat(y);
+
+    int x0 = WrapIndex(cellX, periodX);
+    int y0 = WrapIndex(cellY, periodY);
+    int x1 = (x0 + 1 == periodX) ? 0 : x0 + 1;
+    int y1 = (y0 + 1 == periodY) ? 0 : y0 + 1;
+
+    int h00, h10, h01, h11;
+    if (periodX <= 256 && periodY <= 256)
+    {
+        int A0 = PermutationTable[x0];
+        int B0 = PermutationTable[x1];
+        h00 = PermutationTable[(A0 + y0) & 0xff];
+        h10 = PermutationTable[(B0 + y0) & 0xff];
+        h01 = PermutationTable[(A0 + y1) & 0xff];
+        h11 = PermutationTable[(B0 + y1) & 0xff];
+    }
+    else
+    {
+        h00 = PeriodicLatticeHash2D(x0, y0);
+        h10 = PeriodicLatticeHash2D(x1, y0);
+        h01 = PeriodicLatticeHash2D(x0, y1);
+        h11 = PeriodicLatticeHash2D(x1, y1);
+    }
+
+    return CbFloatLerp(CbFloatLerp(FloatGradient2D(h00, x, y), FloatGradient2D(h10, x-1, y), fadedX),
+        CbFloatLerp(FloatGradient2D(h01, x, y-1), FloatGradient2D(h11, x-1, y-1), fadedX), fadedY);
+}
+
+
+
+/// <summary>
+/// 3D Perlin Noise that repeats every period along each axis. \n
+/// Using z as time with periodZ as the loop length gives a tileable 2D texture that also loops seamlessly.
+/// As in Perlin2DPeriodic, periods longer than 256 hash the wrapped cells instead of using the permutation table.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <param name="periodX"></param>
+/// <param name="periodY"></param>
+/// <param name="periodZ"></param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::Perlin3DPeriodic(float x, float y, float z, int periodX, int periodY, int periodZ) {
+    periodX = MAX(periodX, 1);
+    periodY = MAX(periodY, 1);
+    periodZ = MAX(periodZ, 1);
+    const int cellX = FastFloorToInt(x);
+    const int cellY = FastFloorToInt(y);
+    const int cellZ = FastFloorToInt(z);
+    x -= (float)cellX;
+    y -= (float)cellY;
+    z -= (float)cellZ;
+    float fadedX = FadeFloat(x);
+    float fadedY = FadeFloat(y);
+    float fadedZ = FadeFloat(z);
+
+    int xs[2], ys[2], zs[2];
+    xs[0] = WrapIndex(cellX, periodX);
+    ys[0] = WrapIndex(cellY, periodY);
+    zs[0] = WrapIndex(cellZ, periodZ);
+    xs[1] = (xs[0] + 1 == periodX) ? 0 : xs[0] + 1;
+    ys[1] = (ys[0] + 1 == periodY) ? 0 : ys[0] + 1;
+    zs[1] = (zs[0] + 1 == periodZ) ? 0 : zs[0] + 1;
+
+    const bool useTable = (periodX <= 256 && periodY <= 256 && periodZ <= 256);
+    float n[8];
+    for (int i = 0; i < 8; i++)
+    {
+        int cornerX = i & 1;
+        int cornerY = (i >> 1) & 1;
+        int cornerZ = (i >> 2) & 1;
+        int hash = useTable ? PermutationTable[(PermutationTable[(PermutationTable[xs[cornerX]] + ys[cornerY]) & 0xff] + zs[cornerZ]) & 0xff]
+            : PeriodicLatticeHash3D(xs[cornerX], ys[cornerY], zs[cornerZ]);
+        n[i] = FloatGradient3D(hash, x - (float)cornerX, y - (float)cornerY, z - (float)cornerZ);
+    }
+
+    return CbFloatLerp(CbFloatLerp(CbFloatLerp(n[0], n[1], fadedX), CbFloatLerp(n[2], n[3], fadedX), fadedY),
+        CbFloatLerp(CbFloatLerp(n[4], n[5], fadedX), CbFloatLerp(n[6], n[7], fadedX), fadedY), fadedZ);
+}
+
+
+
+/// <summary>
+/// Smooth 2D value noise that repeats every period along each axis. \n
+/// Unlike ValueNoise2D the lattice values are hashed from the wrapped cell, the seed and seedValue only,
+/// so the same point always returns the same value. Ranges from -1 to 1.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="periodX"></param>
+/// <param name="periodY"></param>
+/// <param name="seedValue"></param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::ValueNoise2DPeriodic(float x, float y, int periodX, int periodY, int seedValue) {
+    periodX = MAX(periodX, 1);
+    periodY = MAX(periodY, 1);
+    const int cellX = FastFloorToInt(x);
+    const int cellY = FastFloorToInt(y);
+    float fadedX = FadeFloat(x - (float)cellX);
+    float fadedY = FadeFloat(y - (float)cellY);
+    const unsigned int seed = (unsigned int)m_gdtSeed ^ ((unsigned int)seedValue * 0x85ebca6bu);
+
+    int x0 = WrapIndex(cellX, periodX);
+    int y0 = WrapIndex(cellY, periodY);
+    int x1 = (x0 + 1 == periodX) ? 0 : x0 + 1;
+    int y1 = (y0 + 1 == periodY) ? 0 : y0 + 1;
+
+    const float scale = 1.0f / 8388607.5f;
+    float v00 = (float)(HashCoordinates2D<unsigned int>(seed, x0, y0) & 0xffffff) * scale - 1.0f;
+    float v10 = (float)(HashCoordinates2D<unsigned int>(seed, x1, y0) & 0xffffff) * scale - 1.0f;
+    float v01 = (float)(HashCoordinates2D<unsigned int>(seed, x0, y1) & 0xffffff) * scale - 1.0f;
+    float v11 = (float)(HashCoordinates2D<unsigned int>(seed, x1, y1) & 0xffffff) * scale - 1.0f;
+
+    return CbFloatLerp(CbFloatLerp(v00, v10, fadedX), CbFloatLerp(v01, v11, fadedX), fadedY);
+}
+
+
+
+/// <summary>
+/// Smooth 3D value noise that repeats every period along each axis. Ranges from -1 to 1.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <param name="periodX"></param>
+/// <param name="periodY"></param>
+/// <param name="periodZ"></param>
+/// <param name="seedValue"></param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::ValueNoise3DPeriodic(float x, float y, float z, int periodX, int periodY, int periodZ, int seedValue) {
+    periodX = MAX(periodX, 1);
+    periodY = MAX(periodY, 1);
+    periodZ = MAX(periodZ, 1);
+    const int cellX = FastFloorToInt(x);
+    const int cellY = FastFloorToInt(y);
+    const int cellZ = FastFloorToInt(z);
+    float fadedX = FadeFloat(x - (float)cellX);
+    float fadedY = FadeFloat(y - (float)cellY);
+    float fadedZ = FadeFloat(z - (float)cellZ);
+    const unsigned int seed = (unsigned int)m_gdtSeed ^ ((unsigned int)seedValue * 0x85ebca6bu);
+
+    int xs[2], ys[2], zs[2];
+    xs[0] = WrapIndex(cellX, periodX);
+    ys[0] = WrapIndex(cellY, periodY);
+    zs[0] = WrapIndex(cellZ, periodZ);
+    xs[1] = (xs[0] + 1 == periodX) ? 0 : xs[0] + 1;
+    ys[1] = (ys[0] + 1 == periodY) ? 0 : ys[0] + 1;
+    zs[1] = (zs[0] + 1 == periodZ) ? 0 : zs[0] + 1;
+
+    const float scale = 1.0f / 8388607.5f;
+    float v[8];
+    for (int i = 0; i < 8; i++)
+    {
+        unsigned int hash = HashCoordinates3D<unsigned int>(seed, xs[i & 1], ys[(i >> 1) & 1], zs[(i >> 2) & 1]);
+        v[i] = (float)(hash & 0xffffff) * scale - 1.0f;
+    }
+
+    return CbFloatLerp(CbFloatLerp(CbFloatLerp(v[0], v[1], fadedX), CbFloatLerp(v[2], v[3], fadedX), fadedY),
+        CbFloatLerp(CbFloatLerp(v[4], v[5], fadedX), CbFloatLerp(v[6], v[7], fadedX), fadedY), fadedZ);
+}
+
+
+
+/**
+* \brief Value noise, -1 - 1, with the lattice values hashed from the seed instead of drawn from the generator. \n
+* Unlike ValueNoise2D it is continuous, never advances the generator and is safe to call from many threads.
+* It gives the same values as ValueNoise2DPeriodic for points between 0 and the period.
+*/
+template<typename T>
+float grng<T>::SmoothValueNoise2D(float x, float y, int seedValue) const {
+    float value;
+    SmoothValueNoise2D(&x, &y, &value, 1, seedValue);
+    return value;
+}
+
+
+
+/**
+* \brief The 3D SmoothValueNoise2D, the same values as ValueNoise3DPeriodic for points between 0 and the period
+*/
+template<typename T>
+float grng<T>::SmoothValueNoise3D(float x, float y, float z, int seedValue) const {
+    float value;
+    SmoothValueNoise3D(&x, &y, &z, &value, 1, seedValue);
+    return value;
+}
+
+
+
+/**
+* \brief SmoothValueNoise2D over arrays of coordinates
+*/
+template<typename T>
+void grng<T>::SmoothValueNoise2D(const float* x, const float* y, float* out, size_t count, int seedValue) const {
+    const unsigned int seed = (unsigned int)m_gdtSeed ^ ((unsigned int)seedValue * 0x85ebca6bu);
+    const float scale = 1.0f / 8388607.5f;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int cellX = FastFloorToInt(x[i]);
+        const int cellY = FastFloorToInt(y[i]);
+        float fadedX = FadeFloat(x[i] - (float)cellX);
+        float fadedY = FadeFloat(y[i] - (float)cellY);
+
+        float v00 = (float)(HashCoordinates2D<unsigned int>(seed, cellX, cellY) & 0xffffff) * scale - 1.0f;
+        float v10 = (float)(HashCoordinates2D<unsigned int>(seed, cellX + 1, cellY) & 0xffffff) * scale - 1.0f;
+        float v01 = (float)(HashCoordinates2D<unsigned int>(seed, cellX, cellY + 1) & 0xffffff) * scale - 1.0f;
+        float v11 = (float)(HashCoordinates2D<unsigned int>(seed, cellX + 1, cellY + 1) & 0xffffff) * scale - 1.0f;
+
+        out[i] = CbFloatLerp(CbFloatLerp(v00, v10, fadedX), CbFloatLerp(v01, v11, fadedX), fadedY);
+    }
+}
+
+
+
+/**
+* \brief SmoothValueNoise3D over arrays of coordinates
+*/
+template<typename T>
+void grng<T>::SmoothValueNoise3D(const float* x, const float* y, const float* z, float* out, size_t count, int seedValue) const {
+    const unsigned int seed = (unsigned int)m_gdtSeed ^ ((unsigned int)seedValue * 0x85ebca6bu);
+    const float scale = 1.0f / 8388607.5f;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int cellX = FastFloorToInt(x[i]);
+        const int cellY = FastFloorToInt(y[i]);
+        const int cellZ = FastFloorToInt(z[i]);
+        float fadedX = FadeFloat(x[i] - (float)cellX);
+        float fadedY = FadeFloat(y[i] - (float)cellY);
+        float fadedZ = FadeFloat(z[i] - (float)cellZ);
+
+        float v[8];
+        for (int c = 0; c < 8; c++)
+        {
+            unsigned int hash = HashCoordinates3D<unsigned int>(seed, cellX + (c & 1), cellY + ((c >> 1) & 1), cellZ + ((c >> 2) & 1));
+            v[c] = (float)(hash & 0xffffff) * scale - 1.0f;
+        }
+
+        out[i] = CbFloatLerp(CbFloatLerp(CbFloatLerp(v[0], v[1], fadedX), CbFloatLerp(v[2], v[3], fadedX), fadedY),
+            CbFloatLerp(CbFloatLerp(v[4], v[5], fadedX), CbFloatLerp(v[6], v[7], fadedX), fadedY), fadedZ);
+    }
+}
+
+
+
+/**
+* \brief Fills out with a width * height seamless tile of octaved periodic Perlin noise, row major by y. \n
+* The tile spans periodX by periodY lattice cells of the first octave and every further octave doubles
+* both frequency and period, so each octave, and the sum, wraps exactly at the tile edges. Octaves whose
+* period would leave the int range are dropped. The result is divided by the amplitude sum so it stays
+* within the range of a single octave, unless the amplitudes cancel to zero, then it is left unscaled.
+*/
+template<typename T>
+void grng<T>::PerlinTile2D(float* out, int width, int height, int periodX, int periodY, int octaveAmount, float noisePersistance) {
+    if (width <= 0 || height <= 0) return;
+    if (octaveAmount < 1) octaveAmount = 1;
+    if (octaveAmount > 16) octaveAmount = 16;
+    periodX = MAX(periodX, 1);
+    periodY = MAX(periodY, 1);
+
+    const float stepX = (float)periodX / (float)width;
+    const float stepY = (float)periodY / (float)height;
+    const size_t sampleCount = (size_t)width * (size_t)height;
+    float amplitudeSum = 0;
+    float amplitude = 1;
+    size_t i = 0;
+
+    for (i = 0; i < sampleCount; i++) out[i] = 0;
+
+    for (int octave = 0; octave < octaveAmount; octave++)
+    {
+        const int scale = 1 << octave;
+        const long long octavePeriodX = (long long)periodX * scale;
+        const long long octavePeriodY = (long long)periodY * scale;
+        if (octavePeriodX > INT_MAX || octavePeriodY > INT_MAX) break;
+
+        for (int y = 0; y < height; y++)
+        {
+            float sampleY = (float)y * stepY * scale;
+            float* row = out + (size_t)y * width;
+            for (int x = 0; x < width; x++)
+            {
+                row[x] += Perlin2DPeriodic((float)x * stepX * scale, sampleY, (int)octavePeriodX, (int)octavePeriodY) * amplitude;
+            }
+        }
+
+        amplitudeSum += amplitude;
+        amplitude *= noisePersistance;
+    }
+
+    const float normalize = (amplitudeSum != 0) ? 1.0f / amplitudeSum : 1.0f;
+    for (i = 0; i < sampleCount; i++) out[i] *= normalize;
+}
+
+
+
+/// <summary>
+/// Returns gradient value
+/// </summary>
+/// <param name="hash"></param>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::FloatGradient(int hash, float x) {
+    return ((hash&1) == 0 ? x : -x);
+}
+
+
+
+
+
+/// <summary>
+/// Returns gradient value
+/// </summary>
+/// <param name="hash"></param>
+/// <param name="x"></param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::FloatGradient2D(int hash, float x, float y) {
+    return RealGradient2D<float>(hash, x, y, m_udtGradientSet);
+}
+
+
+
+
+/// <summary>
+/// Returns gradient value
+/// </summary>
+/// <param name="hash"></param>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns></returns>
+template<typename T>
+float grng<T>::FloatGradient3D(int hash, float x, float y, float z) {
+    return RealGradient3D<float>(hash, x, y, z, m_udtGradientSet);
+}
+
+
+
+/// <summary>
+/// Returns gradient value
 /// </summary>
 /// <param name="hash"></param>
 /// <param name="x"></param>
@@ -1330,10 +2649,7 @@ float grng<T>::FloatGradient3D(int hash, float x, float y, float z) {
 /// <returns></returns>
 template<typename T>
 double grng<T>::DoubleGradient(int hash, double x, double y, double z) {
-    int h = hash & 15;
-    double u = h<8 ? x : y,
-            v = h<4 ? y : h==12||h==14 ? x : z;
-    return ((h&1) == 0 ? u : -u) + ((h&2) == 0 ? v : -v);
+    return RealGradient3D<double>(hash, x, y, z, m_udtGradientSet);
 }
 
 
@@ -1437,6 +2753,23 @@ float grng<T>::OffsetPerlinNoise3D(int xIteration, int yIteration, int zIteratio
 template<typename T>
 float** grng<T>::PerlinOctaves2D(int octaveAmount, int resolution, float offsetX, float offsetY,
 float noisePersistance, float noiseLacunarity, float noiseScale, float roughness, bool normalizeHeightGlobally)
+{
+    return PerlinOctaves2D(octaveAmount, resolution, offsetX, offsetY, noisePersistance, noiseLacunarity, noiseScale, roughness,
+        normalizeHeightGlobally ? Octave_Normalization_Global : Octave_Normalization_Local, 0.0f);
+}
+
+
+
+/// <summary>
+/// Creates perlin fractal brownian octave noise, a (resolution + 1) * (resolution + 1) map indexed [x][y]. \n
+/// Octaves with more than half a cycle per map sample are skipped, and octaves stop being added once the
+/// amplitude still to come is below amplitudeEpsilon. Analytic normalization maps the sum against the
+/// range the kept octave amplitudes allow, so no min/max pass over the map is needed.
+/// </summary>
+template<typename T>
+float** grng<T>::PerlinOctaves2D(int octaveAmount, int resolution, float offsetX, float offsetY,
+float noisePersistance, float noiseLacunarity, float noiseScale, float roughness,
+OctaveNormalization_t normalization, float amplitudeEpsilon)
 {
     if(roughness == 0) roughness = 10000;
     if(octaveAmount < 1) octaveAmount = 1;
@@ -1451,8 +2784,12 @@ float noisePersistance, float noiseLacunarity, float noiseScale, float roughness
     float **noiseMap = 0;
     noiseMap = new float*[resolution+1];
 
-    float octaveOffsetsX[octaveAmount] = {0};
-    float octaveOffsetsY[octaveAmount] = {0};
+    std::vector<float> octaveOffsetsX(octaveAmount);
+    std::vector<float> octaveOffsetsY(octaveAmount);
+    std::vector<float> octaveFrequencies(octaveAmount);
+    std::vector<float> octaveAmplitudes(octaveAmount);
+    std::vector<float> octaveCycles(octaveAmount);
+    std::vector<int> keptOctaves(octaveAmount);
     float center = resolution/2;
     float amplitude = 1;
     float frequency = 1;
@@ -1466,95 +2803,209 @@ float noisePersistance, float noiseLacunarity, float noiseScale, float roughness
         float newY = RangeFloat(-roughness, roughness) - offsetY - center;
         octaveOffsetsX[i] = newX;
         octaveOffsetsY[i] = newY;
+        octaveFrequencies[i] = frequency;
+        octaveAmplitudes[i] = amplitude;
+
+        //OffsetPerlinNoise2D divides by noiseScale * frequency, so that is the wavelength in samples
+        float devisor = (noiseScale != 0 && frequency != 0) ? noiseScale * frequency : 1;
+        octaveCycles[i] = 1.0f / devisor;
+
+        amplitude *= noisePersistance;
+        frequency *= noiseLacunarity;
     }
 
-    for(x = 0; x < (resolution+1); x++)
+    const int keptAmount = SelectVisibleOctaves(&octaveCycles[0], &octaveAmplitudes[0], octaveAmount, amplitudeEpsilon, &keptOctaves[0]);
+
+    //Perlin2D stays within -1 to 1, so every octave of OffsetPerlinNoise2D stays within -3 to 1
+    float lowerBound = 0;
+    float upperBound = 0;
+    for (int k = 0; k < keptAmount; k++)
     {
-        noiseMap[x] = new float[resolution+1];
+        lowerBound -= 3 * octaveAmplitudes[keptOctaves[k]];
+        upperBound += octaveAmplitudes[keptOctaves[k]];
+    }
 
-        for(y = 0; y < (resolution + 1); y++)
+    //The octave sums are built OctaveBandSize rows of y at a time through PerlinGrid2D, with the
+    //coordinates OffsetPerlinNoise2D would use, then normalized in the original x, y order
+    const int side = resolution + 1;
+    std::vector<float> octaveX((size_t)keptAmount * side);
+    std::vector<float> octaveY((size_t)keptAmount * side);
+    for (int k = 0; k < keptAmount; k++)
+    {
+        int j = keptOctaves[k];
+        float devisor = (noiseScale != 0 && octaveFrequencies[j] != 0) ? noiseScale * octaveFrequencies[j] : 1;
+        for (int i = 0; i < side; i++)
         {
-            float noiseValue = 0;
-            amplitude = 1;
-            frequency = 1;
-            for(int j = 0; j < octaveAmount; j++) {
-                float noise = OffsetPerlinNoise2D(x,y,noiseScale,octaveOffsetsX[j], octaveOffsetsY[j],center,center,frequency);
-                noiseValue += (noise * amplitude);
-                amplitude *= noisePersistance;
-                frequency *= noiseLacunarity;
-            }
+            octaveX[(size_t)k * side + i] = (i - center + octaveOffsetsX[j]) / devisor;
+            octaveY[(size_t)k * side + i] = (i - center - octaveOffsetsY[j]) / devisor;
+        }
+    }
+
+    for(x = 0; x < side; x++)
+    {
+        noiseMap[x] = new float[side];
+    }
+
+    std::vector<float> bandSums((size_t)OctaveBandSize * side);
+    std::vector<float> bandScratch((size_t)OctaveBandSize * side);
+    for (int bandStart = 0; bandStart < side; bandStart += OctaveBandSize)
+    {
+        const int bandRows = (side - bandStart < OctaveBandSize) ? side - bandStart : OctaveBandSize;
+        std::fill(bandSums.begin(), bandSums.end(), 0.0f);
 
-            noiseMap[x][y] = noiseValue;
+        for (int k = 0; k < keptAmount; k++)
+        {
+            AccumulatePerlinGrid(&octaveX[(size_t)k * side], side, &octaveY[(size_t)k * side + bandStart], bandRows,
+                octaveAmplitudes[keptOctaves[k]], &bandScratch[0], &bandSums[0]);
+        }
 
-            if (noiseValue < minimumHeight)
+        for (int row = 0; row < bandRows; row++)
+        {
+            for (x = 0; x < side; x++)
             {
-                minimumHeight = noiseValue;
+                noiseMap[x][bandStart + row] = bandSums[(size_t)row * side + x];
             }
-            else if (noiseValue > maximumHeight)
+        }
+    }
+
+    for(x = 0; x < side; x++)
+    {
+        for(y = 0; y < side; y++)
+        {
+            float noiseValue = noiseMap[x][y];
+
+            switch (normalization)
             {
-                maximumHeight = noiseValue;
-            }
+            case Octave_Normalization_Analytic:
+                noiseMap[x][y] = InverseLerpClamped(lowerBound, upperBound, noiseValue);
+                break;
 
-            if (normalizeHeightGlobally)
+            case Octave_Normalization_Global:
             {
-                float normalizedHeight = (noiseMap[x][y] + 1) / (maximumHeight / 0.9f);
+                if (noiseValue > maximumHeight) maximumHeight = noiseValue;
+                float normalizedHeight = (noiseValue + 1) / (maximumHeight / 0.9f);
                 noiseMap[x][y] = Clamp(normalizedHeight, 0, INT_MAX);
-
+                break;
             }
 
+            default:
+                if (noiseValue < minimumHeight) minimumHeight = noiseValue;
+                if (noiseValue > maximumHeight) maximumHeight = noiseValue;
+                noiseMap[x][y] = noiseValue;
+                break;
+            }
         }
+    }
 
-        if (normalizeHeightGlobally == false)
+    if (normalization == Octave_Normalization_Local)
+    {
+        for(x = 0; x < (resolution+1); x++)
         {
-            for (x = 0, y=0; x < resolution; y++)
+            for(y = 0; y < (resolution + 1); y++)
             {
-                if (y >= resolution)
-                {
-                    y = 0;
-                    x++;
-                }
                 noiseMap[x][y] = InverseLerpClamped(minimumHeight, maximumHeight, noiseMap[x][y]);
-			}
+            }
         }
+    }
 
+    return noiseMap;
 
-    }
+}
 
 
 
-    for(int i = 0; i < SQR(resolution+1); i++) {
-        noiseMap[i] = new float[resolution+1];
-        amplitude = 1;
-        frequency = 1;
-        float noiseValue = 0;
+/// <summary>
+/// Creates perlin fractal brownian octave noise written straight into 8 bit, 16 bit or half float samples. \n
+/// Octaves are picked the same way as PerlinOctaves2D. Samples are summed OctaveBandSize lines at a time into
+/// a band sized float buffer, normalized and quantized before the next band, so no float copy of the map is ever held. Passing
+/// minValue >= maxValue uses the analytic bounds of the kept octaves, otherwise the given bounds map to 0 - 1.
+/// The output holds (resolution + 1) * (resolution + 1) samples laid out like the float map, x * (resolution + 1) + y.
+/// </summary>
+template<typename T>
+void grng<T>::PerlinOctaves2DQuantized(void* out, QuantizedFormat_t format, int octaveAmount, int resolution, float offsetX, float offsetY,
+float noisePersistance, float noiseLacunarity, float noiseScale, float roughness, float amplitudeEpsilon,
+float minValue, float maxValue)
+{
+    if(roughness == 0) roughness = 10000;
+    if(octaveAmount < 1) octaveAmount = 1;
+    if(noisePersistance <= 0) noisePersistance = 0.001f;
+    if(noiseLacunarity < 0.01f) noiseLacunarity = 0.01f;
+    if(resolution <= 0 || out == NULL) return;
+
+    std::vector<float> octaveOffsetsX(octaveAmount);
+    std::vector<float> octaveOffsetsY(octaveAmount);
+    std::vector<float> octaveFrequencies(octaveAmount);
+    std::vector<float> octaveAmplitudes(octaveAmount);
+    std::vector<float> octaveCycles(octaveAmount);
+    std::vector<int> keptOctaves(octaveAmount);
+    std::vector<float> line(resolution + 1);
+    float center = resolution/2;
+    float amplitude = 1;
+    float frequency = 1;
 
+    for (int i = 0; i < octaveAmount; i++)
+    {
+        octaveOffsetsX[i] = RangeFloat(-roughness, roughness) + offsetX + center;
+        octaveOffsetsY[i] = RangeFloat(-roughness, roughness) - offsetY - center;
+        octaveFrequencies[i] = frequency;
+        octaveAmplitudes[i] = amplitude;
+        float devisor = (noiseScale != 0 && frequency != 0) ? noiseScale * frequency : 1;
+        octaveCycles[i] = 1.0f / devisor;
+        amplitude *= noisePersistance;
+        frequency *= noiseLacunarity;
+    }
 
+    const int keptAmount = SelectVisibleOctaves(&octaveCycles[0], &octaveAmplitudes[0], octaveAmount, amplitudeEpsilon, &keptOctaves[0]);
 
-        for(int j = 0; j < octaveAmount; j++) {
-            float noise = OffsetPerlinNoise2D(x,y,noiseScale,octaveOffsetsX[j], octaveOffsetsY[j],center,center,frequency);
-            noiseValue += (noise * amplitude);
-            amplitude *= noisePersistance;
-            frequency *= noiseLacunarity;
+    if (minValue >= maxValue)
+    {
+        minValue = 0;
+        maxValue = 0;
+        for (int k = 0; k < keptAmount; k++)
+        {
+            minValue -= 3 * octaveAmplitudes[keptOctaves[k]];
+            maxValue += octaveAmplitudes[keptOctaves[k]];
         }
+    }
 
+    const int side = resolution + 1;
+    std::vector<float> octaveX((size_t)keptAmount * side);
+    std::vector<float> octaveY((size_t)keptAmount * side);
+    for (int k = 0; k < keptAmount; k++)
+    {
+        int j = keptOctaves[k];
+        float devisor = (noiseScale != 0 && octaveFrequencies[j] != 0) ? noiseScale * octaveFrequencies[j] : 1;
+        for (int i = 0; i < side; i++)
+        {
+            octaveX[(size_t)k * side + i] = (i - center + octaveOffsetsX[j]) / devisor;
+            octaveY[(size_t)k * side + i] = (i - center - octaveOffsetsY[j]) / devisor;
+        }
+    }
 
+    const size_t lineBytes = (size_t)side * QuantizedFormatBytes(format);
+    unsigned char* target = (unsigned char*)out;
 
-        noiseMap[x][y] = noiseValue;
-
-        y+=1;
+    //Lines run along y, so OctaveBandSize lines of x are summed together through PerlinGrid2D
+    //and each is gathered out of the band and quantized
+    std::vector<float> bandSums((size_t)OctaveBandSize * side);
+    std::vector<float> bandScratch((size_t)OctaveBandSize * side);
+    for (int bandStart = 0; bandStart < side; bandStart += OctaveBandSize)
+    {
+        const int bandColumns = (side - bandStart < OctaveBandSize) ? side - bandStart : OctaveBandSize;
+        std::fill(bandSums.begin(), bandSums.end(), 0.0f);
 
-        if(y >= resolution) {
-            x+=1;
-            y=0;
-        }
-        else if(x >= resolution) {
-            break;
+        for (int k = 0; k < keptAmount; k++)
+        {
+            AccumulatePerlinGrid(&octaveX[(size_t)k * side + bandStart], bandColumns, &octaveY[(size_t)k * side], side,
+                octaveAmplitudes[keptOctaves[k]], &bandScratch[0], &bandSums[0]);
         }
 
+        for (int column = 0; column < bandColumns; column++)
+        {
+            for (int y = 0; y < side; y++) line[y] = bandSums[(size_t)y * bandColumns + column];
+            QuantizeSamples(&line[0], line.size(), minValue, maxValue, format, target + lineBytes * (bandStart + column));
+        }
     }
-
-    return noiseMap;
-
 }
 
 
@@ -8,12 +8,17 @@
 #define GRNG_H_INCLUDED
 
 #include <math.h>
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <functional>
 #include <stddef.h>
+#include <string.h>
 #include <type_traits>
+#include <vector>
 #include "grandomAlgorithms.h"
+#include "gfixed.h"
+#include "gquantize.h"
 
 /**
  * @brief Possible weights for a weighted random value to lean towards
@@ -50,6 +55,80 @@ typedef enum RandomAlgorithmChoices {
 
 
 
+/**
+ * @brief How PerlinOctaves2D maps the octave sum into 0 - 1
+ */
+typedef enum OctaveNormalizations {
+
+    ///Min/max of the finished map, needs a second pass over it
+    Octave_Normalization_Local,
+
+    ///Against the running maximum while the map is built, the old normalizeHeightGlobally
+    Octave_Normalization_Global,
+
+    ///Against the bounds implied by the octave amplitudes, no extra pass
+    Octave_Normalization_Analytic
+
+} OctaveNormalization_t;
+
+
+
+/**
+ * @brief Gradient direction sets the Perlin kernels can pick their corner gradients from
+ */
+typedef enum GradientSets {
+
+    ///The original Perlin directions, the 4 diagonals in 2D and the 12 cube edges in 3D
+    Gradient_Set_Classic,
+
+    ///32 evenly spread directions in 2D and 3D, less axis aligned artifacting at the same cost
+    Gradient_Set_Extended
+
+} GradientSet_t;
+
+
+
+/**
+ * @brief A 2D noise value together with its analytic gradient
+ */
+typedef struct NoiseDerivative2D {
+
+    float value;
+    float dx;
+    float dy;
+
+} NoiseDerivative2D_t;
+
+
+
+/**
+ * @brief A 3D noise value together with its analytic gradient
+ */
+typedef struct NoiseDerivative3D {
+
+    float value;
+    float dx;
+    float dy;
+    float dz;
+
+} NoiseDerivative3D_t;
+
+
+
+/**
+ * @brief A double precision 3D noise value together with its analytic gradient
+ */
+typedef struct NoiseDerivative3DDouble {
+
+    double value;
+    double dx;
+    double dy;
+    double dz;
+
+} NoiseDerivative3DDouble_t;
+
+
+
 
 template<typename T>
 class grng
@@ -57,6 +136,11 @@ class grng
 
 private:
 
+    ///Rows of a map evaluated together by the grid octave paths
+    static const int OctaveBandSize = 64;
+
+    void AccumulatePerlinGrid(const float* x, int width, const float* y, int height, float amplitude,
+        float* scratch, float* sum);
 
 
 protected:
@@ -70,6 +154,9 @@ protected:
     ///The algorithm selected
     T(*selectedAlgorithm)(T);
 
+    ///Directions the Perlin kernels take their corner gradients from
+    GradientSet_t m_udtGradientSet;
+
 
 
 
@@ -133,6 +220,22 @@ public:
         return m_udtAlgorithmSelection;
     }
 
+    /**
+    * \brief Sets the gradient directions Perlin2D, Perlin3D, ImprovedNoise and their variants use
+    */
+    inline void SetGradientSet(GradientSet_t gradientSet)
+    {
+        m_udtGradientSet = gradientSet;
+    }
+
+    /**
+    * \brief Returns the gradient directions the Perlin kernels use
+    */
+    const inline GradientSet_t GetGradientSet() const
+    {
+        return m_udtGradientSet;
+    }
+
     T Next();
     T Next(T maxValue);
     T Range(T minValue, T maxValue);
@@ -170,6 +273,53 @@ public:
     float Perlin3D(float x, float y, float z);
     double ImprovedNoise(double x, double y);
     double ImprovedNoise(double x, double y, double z);
+    NoiseDerivative2D_t Perlin2DDerivative(float x, float y);
+    NoiseDerivative3D_t Perlin3DDerivative(float x, float y, float z);
+    NoiseDerivative3DDouble_t ImprovedNoiseDerivative(double x, double y, double z);
+    void Perlin2DDerivative(const float* x, const float* y, float* value, float* dx, float* dy, size_t count);
+    void Perlin3DDerivative(const float* x, const float* y, const float* z, float* value, float* dx, float* dy, float* dz, size_t count);
+
+    template<typename Real>
+    Real PerlinKernel2D(Real x, Real y);
+
+    template<typename Real>
+    Real PerlinKernel3D(Real x, Real y, Real z);
+
+    template<typename Real>
+    void PerlinKernel2D(const Real* x, const Real* y, Real* out, size_t count);
+
+    template<typename Real>
+    void PerlinKernel3D(const Real* x, const Real* y, const Real* z, Real* out, size_t count);
+
+    template<typename Real>
+    Real PerlinLattice2D(long long cellX, long long cellY, Real x, Real y);
+
+    template<typename Real>
+    Real PerlinLattice3D(long long cellX, long long cellY, long long cellZ, Real x, Real y, Real z);
+
+    float Perlin2DLarge(long long originX, long long originY, float localX, float localY);
+    float Perlin3DLarge(long long originX, long long originY, long long originZ, float localX, float localY, float localZ);
+    void Perlin2DLarge(long long originX, long long originY, const float* localX, const float* localY, float* out, size_t count);
+    void Perlin3DLarge(long long originX, long long originY, long long originZ, const float* localX, const float* localY,
+        const float* localZ, float* out, size_t count);
+
+    float HashedPerlin2D(float x, float y) const;
+    float HashedPerlin3D(float x, float y, float z) const;
+    void HashedPerlin2D(const float* x, const float* y, float* out, size_t count) const;
+    void HashedPerlin3D(const float* x, const float* y, const float* z, float* out, size_t count) const;
+
+    void PerlinGrid2D(const float* x, int width, const float* y, int height, float* out);
+    void PerlinGrid2D(float startX, float startY, float stepX, float stepY, int width, int height, float* out);
+
+    float Perlin2DPeriodic(float x, float y, int periodX, int periodY);
+    float Perlin3DPeriodic(float x, float y, float z, int periodX, int periodY, int periodZ);
+    float ValueNoise2DPeriodic(float x, float y, int periodX, int periodY, int seedValue);
+    float ValueNoise3DPeriodic(float x, float y, float z, int periodX, int periodY, int periodZ, int seedValue);
+    float SmoothValueNoise2D(float x, float y, int seedValue) const;
+    float SmoothValueNoise3D(float x, float y, float z, int seedValue) const;
+    void SmoothValueNoise2D(const float* x, const float* y, float* out, size_t count, int seedValue) const;
+    void SmoothValueNoise3D(const float* x, const float* y, const float* z, float* out, size_t count, int seedValue) const;
+    void PerlinTile2D(float* out, int width, int height, int periodX, int periodY, int octaveAmount, float noisePersistance);
     float FloatGradient(int hash, float x);
     float FloatGradient2D(int hash, float x, float y);
     float FloatGradient3D(int hash, float x, float y, float z);
@@ -183,6 +333,12 @@ public:
 
     float** PerlinOctaves2D(int octaveAmount, int resolution, float offsetX, float offsetY,
         float noisePersistance, float noiseLacunarity, float noiseScale, float roughness, bool normalizeHeightGlobally);
+    float** PerlinOctaves2D(int octaveAmount, int resolution, float offsetX, float offsetY,
+        float noisePersistance, float noiseLacunarity, float noiseScale, float roughness,
+        OctaveNormalization_t normalization, float amplitudeEpsilon);
+    void PerlinOctaves2DQuantized(void* out, QuantizedFormat_t format, int octaveAmount, int resolution, float offsetX, float offsetY,
+        float noisePersistance, float noiseLacunarity, float noiseScale, float roughness, float amplitudeEpsilon,
+        float minValue, float maxValue);
 
     T SmallestRandom(int iterations);
     T LargestRandom(int iterations);
@@ -0,0 +1,464 @@
+/**
+ * @file gsimplex.cpp
+ * @brief Source file for seedable simplex lattice gradient noise in 2D, 3D and 4D
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GSIMPLEX_CPP_INCLUDED
+#define GSIMPLEX_CPP_INCLUDED
+
+#include "gsimplex.h"
+
+
+/// <summary>
+/// Gradient directions for 2D and 3D simplex noise, the midpoints of the cube edges
+/// </summary>
+static const float SimplexGradients3D[12][3] = {
+    { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+    { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+    { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 }
+};
+
+
+
+/// <summary>
+/// Gradient directions for 4D simplex noise, the midpoints of the tesseract edges, shared with grng's gradient tables
+/// </summary>
+static const float (&SimplexGradients4D)[32][4] = GradientTables<float>::Directions4D;
+
+
+
+#pragma region STATIC_MATH
+
+#define SIMPLEX_SKEW2D      0.36602540378443864676f
+#define SIMPLEX_UNSKEW2D    0.21132486540518711775f
+#define SIMPLEX_SKEW3D      0.33333333333333333333f
+#define SIMPLEX_UNSKEW3D    0.16666666666666666667f
+#define SIMPLEX_SKEW4D      0.30901699437494742410f
+#define SIMPLEX_UNSKEW4D    0.13819660112501051518f
+#define SIMPLEX_TWO_PI      6.28318530717958647692f
+
+
+/// <summary>
+/// Zeroes a negative falloff by masking its bits with its sign. \n
+/// A float select here is compiled to branches once the falloff is multiplied after it.
+/// </summary>
+static inline float SimplexClip(float t) {
+    int bits;
+    memcpy(&bits, &t, sizeof(bits));
+    bits &= ~(bits >> 31);
+    memcpy(&t, &bits, sizeof(t));
+    return t;
+}
+
+
+
+/// <summary>
+/// Contribution of one simplex corner: (r^2 - d^2)^4 * (gradient . d), zero outside the radius. \n
+/// Written without branches, and indexing the gradient table in full rather than through a row pointer,
+/// so the batch loops can vectorize.
+/// </summary>
+static inline float SimplexCorner2D(float radius, int gradient, float x, float y) {
+    float t = SimplexClip(radius - x * x - y * y);
+    t *= t;
+    return t * t * (SimplexGradients3D[gradient][0] * x + SimplexGradients3D[gradient][1] * y);
+}
+
+
+
+static inline float SimplexCorner3D(int gradient, float x, float y, float z) {
+    float t = SimplexClip(0.6f - x * x - y * y - z * z);
+    t *= t;
+    return t * t * (SimplexGradients3D[gradient][0] * x + SimplexGradients3D[gradient][1] * y + SimplexGradients3D[gradient][2] * z);
+}
+
+
+
+static inline float SimplexCorner4D(int gradient, float x, float y, float z, float w) {
+    float t = SimplexClip(0.6f - x * x - y * y - z * z - w * w);
+    t *= t;
+    return t * t * (SimplexGradients4D[gradient][0] * x + SimplexGradients4D[gradient][1] * y
+        + SimplexGradients4D[gradient][2] * z + SimplexGradients4D[gradient][3] * w);
+}
+
+#pragma endregion
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gsimplex<T>::gsimplex()
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = 0;
+    m_gdtSeed |= 6256256;
+    BuildPermutation();
+}
+
+
+
+/**
+* \brief Constructor
+*/
+template<typename T>
+gsimplex<T>::gsimplex(const T newSeed)
+{
+    static_assert(std::is_integral<T>::value, "T must be an integral number");
+    m_gdtSeed = newSeed;
+    BuildPermutation();
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename T>
+gsimplex<T>::~gsimplex()
+{
+    m_gdtSeed = 0;
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Sets the seed and rebuilds this instance's permutation from it
+*/
+template<typename T>
+void gsimplex<T>::SetSeed(const T newSeed)
+{
+    m_gdtSeed = newSeed;
+    BuildPermutation();
+}
+
+
+
+/**
+* \brief Shuffles 0 - 255 with a generator seeded by this instance's seed
+*/
+template<typename T>
+void gsimplex<T>::BuildPermutation()
+{
+    grng<T> shuffleRng(m_gdtSeed, Random_Algorithm_Wyhash);
+
+    for (int i = 0; i < 256; i++)
+    {
+        m_iPermutation[i] = i;
+    }
+
+    for (int i = 255; i > 0; i--)
+    {
+        int j = (int)((unsigned long long)shuffleRng.Next() % (unsigned long long)(i + 1));
+        int temp = m_iPermutation[i];
+        m_iPermutation[i] = m_iPermutation[j];
+        m_iPermutation[j] = temp;
+    }
+
+    for (int i = 0; i < 512; i++)
+    {
+        m_iPermutation[i] = m_iPermutation[i & 255];
+        m_iPermutationMod12[i] = m_iPermutation[i] % 12;
+    }
+}
+
+
+
+/// <summary>
+/// 2D simplex noise, 3 corners per sample
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <returns>Noise in about -1 to 1</returns>
+template<typename T>
+inline float gsimplex<T>::Noise2D(float x, float y) const
+{
+    //Skew to find the simplex cell, then unskew the cell origin back
+    float s = (x + y) * SIMPLEX_SKEW2D;
+    int i = RealFloorToInt(x + s);
+    int j = RealFloorToInt(y + s);
+    float t = (float)(i + j) * SIMPLEX_UNSKEW2D;
+    float x0 = x - ((float)i - t);
+    float y0 = y - ((float)j - t);
+
+    //Which of the two triangles the point is in
+    int i1 = (x0 > y0) ? 1 : 0;
+    int j1 = 1 - i1;
+
+    float x1 = x0 - i1 + SIMPLEX_UNSKEW2D;
+    float y1 = y0 - j1 + SIMPLEX_UNSKEW2D;
+    float x2 = x0 - 1.0f + 2.0f * SIMPLEX_UNSKEW2D;
+    float y2 = y0 - 1.0f + 2.0f * SIMPLEX_UNSKEW2D;
+
+    int ii = i & 0xff;
+    int jj = j & 0xff;
+    int g0 = m_iPermutationMod12[ii + m_iPermutation[jj]];
+    int g1 = m_iPermutationMod12[ii + i1 + m_iPermutation[jj + j1]];
+    int g2 = m_iPermutationMod12[ii + 1 + m_iPermutation[jj + 1]];
+
+    float n = SimplexCorner2D(0.5f, g0, x0, y0) +
+        SimplexCorner2D(0.5f, g1, x1, y1) +
+        SimplexCorner2D(0.5f, g2, x2, y2);
+
+    return 70.0f * n;
+}
+
+
+
+/// <summary>
+/// 3D simplex noise, 4 corners per sample
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <returns>Noise in about -1 to 1</returns>
+template<typename T>
+inline float gsimplex<T>::Noise3D(float x, float y, float z) const
+{
+    float s = (x + y + z) * SIMPLEX_SKEW3D;
+    int i = RealFloorToInt(x + s);
+    int j = RealFloorToInt(y + s);
+    int k = RealFloorToInt(z + s);
+    float t = (float)(i + j + k) * SIMPLEX_UNSKEW3D;
+    float x0 = x - ((float)i - t);
+    float y0 = y - ((float)j - t);
+    float z0 = z - ((float)k - t);
+
+    //Rank the offsets to find which of the six tetrahedra the point is in, without branches
+    int xy = (x0 >= y0) ? 1 : 0;
+    int xz = (x0 >= z0) ? 1 : 0;
+    int yz = (y0 >= z0) ? 1 : 0;
+    int i1 = xy & xz, j1 = (1 - xy) & yz, k1 = (1 - xz) & (1 - yz);
+    int i2 = xy | xz, j2 = (1 - xy) | yz, k2 = (1 - xz) | (1 - yz);
+
+    float x1 = x0 - i1 + SIMPLEX_UNSKEW3D;
+    float y1 = y0 - j1 + SIMPLEX_UNSKEW3D;
+    float z1 = z0 - k1 + SIMPLEX_UNSKEW3D;
+    float x2 = x0 - i2 + 2.0f * SIMPLEX_UNSKEW3D;
+    float y2 = y0 - j2 + 2.0f * SIMPLEX_UNSKEW3D;
+    float z2 = z0 - k2 + 2.0f * SIMPLEX_UNSKEW3D;
+    float x3 = x0 - 1.0f + 3.0f * SIMPLEX_UNSKEW3D;
+    float y3 = y0 - 1.0f + 3.0f * SIMPLEX_UNSKEW3D;
+    float z3 = z0 - 1.0f + 3.0f * SIMPLEX_UNSKEW3D;
+
+    int ii = i & 0xff;
+    int jj = j & 0xff;
+    int kk = k & 0xff;
+    const int* p = m_iPermutation;
+    int g0 = m_iPermutationMod12[ii + p[jj + p[kk]]];
+    int g1 = m_iPermutationMod12[ii + i1 + p[jj + j1 + p[kk + k1]]];
+    int g2 = m_iPermutationMod12[ii + i2 + p[jj + j2 + p[kk + k2]]];
+    int g3 = m_iPermutationMod12[ii + 1 + p[jj + 1 + p[kk + 1]]];
+
+    float n = SimplexCorner3D(g0, x0, y0, z0) +
+        SimplexCorner3D(g1, x1, y1, z1) +
+        SimplexCorner3D(g2, x2, y2, z2) +
+        SimplexCorner3D(g3, x3, y3, z3);
+
+    return 32.0f * n;
+}
+
+
+
+/// <summary>
+/// 4D simplex noise, 5 corners per sample
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="z"></param>
+/// <param name="w"></param>
+/// <returns>Noise in about -1 to 1</returns>
+template<typename T>
+inline float gsimplex<T>::Noise4D(float x, float y, float z, float w) const
+{
+    float s = (x + y + z + w) * SIMPLEX_SKEW4D;
+    int i = RealFloorToInt(x + s);
+    int j = RealFloorToInt(y + s);
+    int k = RealFloorToInt(z + s);
+    int l = RealFloorToInt(w + s);
+    float t = (float)(i + j + k + l) * SIMPLEX_UNSKEW4D;
+    float x0 = x - ((float)i - t);
+    float y0 = y - ((float)j - t);
+    float z0 = z - ((float)k - t);
+    float w0 = w - ((float)l - t);
+
+    //Rank each axis by how many of the other offsets it beats, that picks the simplex
+    const int xy = (x0 > y0), xz = (x0 > z0), xw = (x0 > w0);
+    const int yz = (y0 > z0), yw = (y0 > w0), zw = (z0 > w0);
+    const int rankX = xy + xz + xw;
+    const int rankY = (1 - xy) + yz + yw;
+    const int rankZ = (1 - xz) + (1 - yz) + zw;
+    const int rankW = (1 - xw) + (1 - yw) + (1 - zw);
+
+    int i1 = rankX >= 3 ? 1 : 0, j1 = rankY >= 3 ? 1 : 0, k1 = rankZ >= 3 ? 1 : 0, l1 = rankW >= 3 ? 1 : 0;
+    int i2 = rankX >= 2 ? 1 : 0, j2 = rankY >= 2 ? 1 : 0, k2 = rankZ >= 2 ? 1 : 0, l2 = rankW >= 2 ? 1 : 0;
+    int i3 = rankX >= 1 ? 1 : 0, j3 = rankY >= 1 ? 1 : 0, k3 = rankZ >= 1 ? 1 : 0, l3 = rankW >= 1 ? 1 : 0;
+
+    float x1 = x0 - i1 + SIMPLEX_UNSKEW4D, y1 = y0 - j1 + SIMPLEX_UNSKEW4D;
+    float z1 = z0 - k1 + SIMPLEX_UNSKEW4D, w1 = w0 - l1 + SIMPLEX_UNSKEW4D;
+    float x2 = x0 - i2 + 2.0f * SIMPLEX_UNSKEW4D, y2 = y0 - j2 + 2.0f * SIMPLEX_UNSKEW4D;
+    float z2 = z0 - k2 + 2.0f * SIMPLEX_UNSKEW4D, w2 = w0 - l2 + 2.0f * SIMPLEX_UNSKEW4D;
+    float x3 = x0 - i3 + 3.0f * SIMPLEX_UNSKEW4D, y3 = y0 - j3 + 3.0f * SIMPLEX_UNSKEW4D;
+    float z3 = z0 - k3 + 3.0f * SIMPLEX_UNSKEW4D, w3 = w0 - l3 + 3.0f * SIMPLEX_UNSKEW4D;
+    float x4 = x0 - 1.0f + 4.0f * SIMPLEX_UNSKEW4D, y4 = y0 - 1.0f + 4.0f * SIMPLEX_UNSKEW4D;
+    float z4 = z0 - 1.0f + 4.0f * SIMPLEX_UNSKEW4D, w4 = w0 - 1.0f + 4.0f * SIMPLEX_UNSKEW4D;
+
+    int ii = i & 0xff;
+    int jj = j & 0xff;
+    int kk = k & 0xff;
+    int ll = l & 0xff;
+    const int* p = m_iPermutation;
+    int g0 = p[ii + p[jj + p[kk + p[ll]]]] & 31;
+    int g1 = p[ii + i1 + p[jj + j1 + p[kk + k1 + p[ll + l1]]]] & 31;
+    int g2 = p[ii + i2 + p[jj + j2 + p[kk + k2 + p[ll + l2]]]] & 31;
+    int g3 = p[ii + i3 + p[jj + j3 + p[kk + k3 + p[ll + l3]]]] & 31;
+    int g4 = p[ii + 1 + p[jj + 1 + p[kk + 1 + p[ll + 1]]]] & 31;
+
+    float n = SimplexCorner4D(g0, x0, y0, z0, w0) +
+        SimplexCorner4D(g1, x1, y1, z1, w1) +
+        SimplexCorner4D(g2, x2, y2, z2, w2) +
+        SimplexCorner4D(g3, x3, y3, z3, w3) +
+        SimplexCorner4D(g4, x4, y4, z4, w4);
+
+    return 27.0f * n;
+}
+
+
+
+/**
+* \brief 2D simplex noise over arrays of x and y coordinates. \n
+* The kernels floor, pick their simplex and clip their corners without branches and the permutations
+* are ints, so this loop and the 3D one vectorize with gathers for the permutation and gradient lookups.
+*/
+template<typename T>
+void gsimplex<T>::Noise2D(const float* x, const float* y, float* out, size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = Noise2D(x[i], y[i]);
+    }
+}
+
+
+
+/**
+* \brief 3D simplex noise over arrays of x, y and z coordinates
+*/
+template<typename T>
+void gsimplex<T>::Noise3D(const float* x, const float* y, const float* z, float* out, size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = Noise3D(x[i], y[i], z[i]);
+    }
+}
+
+
+
+/**
+* \brief 4D simplex noise over arrays of x, y, z and w coordinates. \n
+* The 4D kernel is too large for gcc to inline into the loop, so it runs one sample at a time.
+*/
+template<typename T>
+void gsimplex<T>::Noise4D(const float* x, const float* y, const float* z, const float* w, float* out, size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = Noise4D(x[i], y[i], z[i], w[i]);
+    }
+}
+
+
+
+/// <summary>
+/// 2D simplex noise that repeats every periodX along x and periodY along y. \n
+/// The skewed simplex lattice cannot wrap on integer cells, so x and y are each mapped onto a circle
+/// and the pair of circles, a torus, is sampled with 4D noise. The radius of each circle keeps one
+/// unit of x or y at about one unit of noise, so features stay the size Noise2D would give.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="periodX">Distance along x before the noise repeats, any positive value</param>
+/// <param name="periodY">Distance along y before the noise repeats, any positive value</param>
+/// <returns>Noise in about -1 to 1</returns>
+template<typename T>
+float gsimplex<T>::Noise2DTileable(float x, float y, float periodX, float periodY) const
+{
+    const float angleX = x * (SIMPLEX_TWO_PI / periodX);
+    const float angleY = y * (SIMPLEX_TWO_PI / periodY);
+    const float radiusX = periodX / SIMPLEX_TWO_PI;
+    const float radiusY = periodY / SIMPLEX_TWO_PI;
+
+    return Noise4D(radiusX * std::cos(angleX), radiusX * std::sin(angleX), radiusY * std::cos(angleY), radiusY * std::sin(angleY));
+}
+
+
+
+/// <summary>
+/// 2D simplex noise animated over time that loops every loopLength. \n
+/// Time walks a circle of loopRadius through the last two dimensions of 4D noise, so the
+/// animation returns to its first frame without a cross fade. A larger radius changes faster.
+/// </summary>
+/// <param name="x"></param>
+/// <param name="y"></param>
+/// <param name="time"></param>
+/// <param name="loopLength">Time before the animation repeats</param>
+/// <param name="loopRadius">Radius of the time circle in noise units</param>
+/// <returns>Noise in about -1 to 1</returns>
+template<typename T>
+float gsimplex<T>::Noise2DLooping(float x, float y, float time, float loopLength, float loopRadius) const
+{
+    const float angle = time * (SIMPLEX_TWO_PI / loopLength);
+    return Noise4D(x, y, loopRadius * std::cos(angle), loopRadius * std::sin(angle));
+}
+
+
+
+/**
+* \brief Fills out with a width * height seamless tile of Noise2DTileable, row major by y. \n
+* The tile covers exactly one period on each axis. The circle coordinates of every column and row
+* are worked out once up front, so the inner loop is only the 4D noise.
+*/
+template<typename T>
+void gsimplex<T>::Tile2D(float* out, int width, int height, float periodX, float periodY) const
+{
+    if (width <= 0 || height <= 0) return;
+
+    const float radiusX = periodX / SIMPLEX_TWO_PI;
+    const float radiusY = periodY / SIMPLEX_TWO_PI;
+    std::vector<float> columnCos(width), columnSin(width);
+
+    for (int x = 0; x < width; x++)
+    {
+        float angle = (float)x * (SIMPLEX_TWO_PI / (float)width);
+        columnCos[x] = radiusX * std::cos(angle);
+        columnSin[x] = radiusX * std::sin(angle);
+    }
+
+    for (int y = 0; y < height; y++)
+    {
+        float angle = (float)y * (SIMPLEX_TWO_PI / (float)height);
+        float rowCos = radiusY * std::cos(angle);
+        float rowSin = radiusY * std::sin(angle);
+        float* row = out + (size_t)y * width;
+
+        for (int x = 0; x < width; x++)
+        {
+            row[x] = Noise4D(columnCos[x], columnSin[x], rowCos, rowSin);
+        }
+    }
+}
+
+
+
+
+#endif
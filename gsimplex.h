@@ -0,0 +1,77 @@
+/**
+ * @file gsimplex.h
+ * @brief Header file for seedable simplex lattice gradient noise in 2D, 3D and 4D
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GSIMPLEX_H_INCLUDED
+#define GSIMPLEX_H_INCLUDED
+
+#include <stddef.h>
+#include <vector>
+#include "grng.h"
+
+
+
+
+template<typename T>
+class gsimplex
+{
+
+private:
+
+    void BuildPermutation();
+
+
+protected:
+
+    ///Seed the permutation was built from
+    T m_gdtSeed;
+
+    ///Shuffled 0 - 255, repeated once so lookups never need wrapping. Ints rather than bytes so the batch loops can gather them
+    int m_iPermutation[512];
+
+    ///The permutation modulo 12, the index into the 2D/3D gradient table
+    int m_iPermutationMod12[512];
+
+
+public:
+
+    gsimplex();
+    gsimplex(const T newSeed);
+    ~gsimplex();
+
+    void SetSeed(const T newSeed);
+
+    /**
+    * \brief Returns this objects seed
+    */
+    const inline T GetSeed()
+    {
+        return m_gdtSeed;
+    }
+
+    float Noise2D(float x, float y) const;
+    float Noise3D(float x, float y, float z) const;
+    float Noise4D(float x, float y, float z, float w) const;
+
+    void Noise2D(const float* x, const float* y, float* out, size_t count) const;
+    void Noise3D(const float* x, const float* y, const float* z, float* out, size_t count) const;
+    void Noise4D(const float* x, const float* y, const float* z, const float* w, float* out, size_t count) const;
+
+    float Noise2DTileable(float x, float y, float periodX, float periodY) const;
+    float Noise2DLooping(float x, float y, float time, float loopLength, float loopRadius) const;
+    void Tile2D(float* out, int width, int height, float periodX, float periodY) const;
+};
+
+
+
+
+#include "gsimplex.cpp"
+
+
+#endif // GSIMPLEX_H_INCLUDED
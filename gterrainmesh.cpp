@@ -0,0 +1,270 @@
+/**
+ * @file gterrainmesh.cpp
+ * @brief Source file for streaming noise height tiles into vertex, normal and index buffers
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GTERRAINMESH_CPP_INCLUDED
+#define GTERRAINMESH_CPP_INCLUDED
+
+#include "gterrainmesh.h"
+
+
+
+
+#pragma region CONSTRUCTORS_DESTRUCTORS
+
+/**
+* \brief Constructor
+*/
+template<typename HeightNoise>
+TerrainMesher<HeightNoise>::TerrainMesher(const HeightNoise& heightNoise, const TerrainMeshSettings_t& settings)
+    : m_udtHeightNoise(heightNoise)
+{
+    SetSettings(settings);
+}
+
+
+
+/**
+* \brief Destructor
+*/
+template<typename HeightNoise>
+TerrainMesher<HeightNoise>::~TerrainMesher()
+{
+}
+
+#pragma endregion
+
+
+
+/**
+* \brief Sets the tile settings, at least one quad per edge, and rebuilds the shared index buffer
+*/
+template<typename HeightNoise>
+void TerrainMesher<HeightNoise>::SetSettings(const TerrainMeshSettings_t& settings)
+{
+    m_udtSettings = settings;
+    if (m_udtSettings.tileQuads < 1) m_udtSettings.tileQuads = 1;
+    BuildIndices();
+}
+
+
+
+/**
+* \brief Returns the vertices in one tile, the (tileQuads + 1)^2 grid then one skirt vertex per border vertex
+*/
+template<typename HeightNoise>
+size_t TerrainMesher<HeightNoise>::GetVerticesPerTile() const
+{
+    const size_t edge = (size_t)m_udtSettings.tileQuads + 1;
+    return edge * edge + ((m_udtSettings.skirtDepth > 0) ? 4 * edge : 0);
+}
+
+
+
+/**
+* \brief Builds the triangle list every tile shares, counter clockwise seen from outside. \n
+* Grid vertex (column, row) is row * (tileQuads + 1) + column. The skirt vertices follow in four runs
+* of tileQuads + 1, under row 0, row tileQuads, column 0 and column tileQuads, each joined to its
+* border by a strip facing away from the tile.
+*/
+template<typename HeightNoise>
+void TerrainMesher<HeightNoise>::BuildIndices()
+{
+    const unsigned int quads = (unsigned int)m_udtSettings.tileQuads;
+    const unsigned int edge = quads + 1;
+    m_vIndices.clear();
+    m_vIndices.reserve((size_t)quads * quads * 6 + ((m_udtSettings.skirtDepth > 0) ? (size_t)quads * 24 : 0));
+
+    for (unsigned int row = 0; row < quads; row++)
+    {
+        for (unsigned int column = 0; column < quads; column++)
+        {
+            const unsigned int a = row * edge + column;
+            const unsigned int b = a + 1;
+            const unsigned int d = a + edge;
+            const unsigned int e = d + 1;
+            m_vIndices.push_back(a); m_vIndices.push_back(d); m_vIndices.push_back(b);
+            m_vIndices.push_back(b); m_vIndices.push_back(d); m_vIndices.push_back(e);
+        }
+    }
+
+    if (m_udtSettings.skirtDepth <= 0) return;
+
+    const unsigned int skirtStart = edge * edge;
+    for (unsigned int side = 0; side < 4; side++)
+    {
+        //Rows 0 and tileQuads run along x, columns 0 and tileQuads along z. Row 0 and column tileQuads
+        //face the other way from the border direction to the skirt, so their triangles are flipped
+        const bool alongX = side < 2;
+        const bool flipped = (side == 0 || side == 3);
+        const unsigned int line = (side == 0 || side == 2) ? 0 : quads;
+
+        for (unsigned int i = 0; i < quads; i++)
+        {
+            const unsigned int p = alongX ? line * edge + i : i * edge + line;
+            const unsigned int q = alongX ? p + 1 : p + edge;
+            const unsigned int skirtP = skirtStart + side * edge + i;
+            const unsigned int skirtQ = skirtP + 1;
+
+            if (flipped)
+            {
+                m_vIndices.push_back(p); m_vIndices.push_back(q); m_vIndices.push_back(skirtP);
+                m_vIndices.push_back(q); m_vIndices.push_back(skirtQ); m_vIndices.push_back(skirtP);
+            }
+            else
+            {
+                m_vIndices.push_back(p); m_vIndices.push_back(skirtP); m_vIndices.push_back(q);
+                m_vIndices.push_back(q); m_vIndices.push_back(skirtP); m_vIndices.push_back(skirtQ);
+            }
+        }
+    }
+}
+
+
+
+/**
+* \brief Builds one tile into vertices, GetVerticesPerTile long. Tile (tileX, tileZ) starts at world
+* (tileX, tileZ) * tileQuads * spacing and shares its border vertices exactly with its neighbours. \n
+* The noise value and gradient are sampled BlockSize vertices at a time. With h = heightScale * noise(x * noiseScale, z * noiseScale)
+* the normal is (-dh/dx, 1, -dh/dz) normalized, each slope being heightScale * noiseScale times the noise derivative.
+*/
+template<typename HeightNoise>
+void TerrainMesher<HeightNoise>::BuildTile(long long tileX, long long tileZ, TerrainVertex_t* vertices) const
+{
+    if (vertices == NULL) return;
+
+    float sampleX[BlockSize], sampleZ[BlockSize], value[BlockSize], slopeX[BlockSize], slopeZ[BlockSize];
+    const int quads = m_udtSettings.tileQuads;
+    const int edge = quads + 1;
+    const size_t gridCount = (size_t)edge * edge;
+    const long long firstColumn = tileX * quads;
+    const long long firstRow = tileZ * quads;
+    const float spacing = m_udtSettings.spacing;
+    const float noiseScale = m_udtSettings.noiseScale;
+    const float heightScale = m_udtSettings.heightScale;
+    const float slopeScale = heightScale * noiseScale;
+
+    for (size_t start = 0; start < gridCount; start += BlockSize)
+    {
+        const int blockCount = (int)((gridCount - start < (size_t)BlockSize) ? gridCount - start : (size_t)BlockSize);
+        int row = (int)(start / edge);
+        int column = (int)(start - (size_t)row * edge);
+        int i = 0;
+
+        for (i = 0; i < blockCount; i++)
+        {
+            TerrainVertex_t& vertex = vertices[start + i];
+            vertex.x = (float)(firstColumn + column) * spacing;
+            vertex.z = (float)(firstRow + row) * spacing;
+            sampleX[i] = vertex.x * noiseScale;
+            sampleZ[i] = vertex.z * noiseScale;
+            if (++column == edge)
+            {
+                column = 0;
+                row++;
+            }
+        }
+
+        m_udtHeightNoise.EvaluateDerivative(sampleX, sampleZ, value, slopeX, slopeZ, blockCount);
+
+        for (i = 0; i < blockCount; i++)
+        {
+            const float normalX = -slopeScale * slopeX[i];
+            const float normalZ = -slopeScale * slopeZ[i];
+            const float inverseLength = 1.0f / std::sqrt(normalX * normalX + 1.0f + normalZ * normalZ);
+            TerrainVertex_t& vertex = vertices[start + i];
+            vertex.y = heightScale * value[i];
+            vertex.normalX = normalX * inverseLength;
+            vertex.normalY = inverseLength;
+            vertex.normalZ = normalZ * inverseLength;
+        }
+    }
+
+    if (m_udtSettings.skirtDepth <= 0) return;
+
+    TerrainVertex_t* skirt = vertices + gridCount;
+    for (int side = 0; side < 4; side++)
+    {
+        const bool alongX = side < 2;
+        const int line = (side == 0 || side == 2) ? 0 : quads;
+
+        for (int i = 0; i < edge; i++)
+        {
+            TerrainVertex_t vertex = vertices[alongX ? (size_t)line * edge + i : (size_t)i * edge + line];
+            vertex.y -= m_udtSettings.skirtDepth;
+            skirt[side * edge + i] = vertex;
+        }
+    }
+}
+
+
+
+/**
+* \brief Builds tileCount tiles, tile i at (tileX[i], tileZ[i]) into vertices + i * GetVerticesPerTile. \n
+* The tiles are split across threadCount threads, zero or less for one per hardware thread. Ranges are
+* handed out in vertices so a few large tiles still spread, and each thread builds the tiles that start
+* inside its range.
+*/
+template<typename HeightNoise>
+void TerrainMesher<HeightNoise>::BuildTiles(const long long* tileX, const long long* tileZ, size_t tileCount,
+    TerrainVertex_t* vertices, int threadCount) const
+{
+    if (tileX == NULL || tileZ == NULL || vertices == NULL || tileCount == 0) return;
+
+    const size_t tileVertices = GetVerticesPerTile();
+    ParallelForRange(tileCount * tileVertices, threadCount, [&](size_t begin, size_t end)
+    {
+        const size_t firstTile = (begin + tileVertices - 1) / tileVertices;
+        const size_t endTile = (end + tileVertices - 1) / tileVertices;
+
+        for (size_t tile = firstTile; tile < endTile; tile++)
+        {
+            BuildTile(tileX[tile], tileZ[tile], vertices + tile * tileVertices);
+        }
+    });
+}
+
+
+
+/**
+* \brief Builds a tilesWide * tilesDeep block of tiles starting at (firstTileX, firstTileZ) and hands each to consumer. \n
+* consumer(tileX, tileZ, vertices, vertexCount) is called from the worker threads as soon as a tile is
+* built, possibly at the same time from several, and the vertices are only valid during the call. Each
+* thread reuses one tile sized buffer, so memory stays at one tile per thread however many are streamed.
+*/
+template<typename HeightNoise>
+template<typename Consumer>
+void TerrainMesher<HeightNoise>::StreamTiles(long long firstTileX, long long firstTileZ, int tilesWide, int tilesDeep,
+    int threadCount, Consumer consumer) const
+{
+    if (tilesWide <= 0 || tilesDeep <= 0) return;
+
+    const size_t tileVertices = GetVerticesPerTile();
+    const size_t tileCount = (size_t)tilesWide * tilesDeep;
+    ParallelForRange(tileCount * tileVertices, threadCount, [&](size_t begin, size_t end)
+    {
+        const size_t firstTile = (begin + tileVertices - 1) / tileVertices;
+        const size_t endTile = (end + tileVertices - 1) / tileVertices;
+        if (firstTile >= endTile) return;
+
+        std::vector<TerrainVertex_t> buffer(tileVertices);
+        for (size_t tile = firstTile; tile < endTile; tile++)
+        {
+            const long long tileX = firstTileX + (long long)(tile % tilesWide);
+            const long long tileZ = firstTileZ + (long long)(tile / tilesWide);
+            BuildTile(tileX, tileZ, &buffer[0]);
+            consumer(tileX, tileZ, (const TerrainVertex_t*)&buffer[0], tileVertices);
+        }
+    });
+}
+
+
+
+
+#endif
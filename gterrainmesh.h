@@ -0,0 +1,147 @@
+/**
+ * @file gterrainmesh.h
+ * @brief Header file for streaming noise height tiles into vertex, normal and index buffers
+ *
+ *
+ * @author Tim Robbins
+ * @version v2.0.0.0
+ * @date 10-19-2026
+ *
+ */
+#ifndef GTERRAINMESH_H_INCLUDED
+#define GTERRAINMESH_H_INCLUDED
+
+#include <stddef.h>
+#include <cmath>
+#include <vector>
+#include "gbatch.h"
+#include "gparallel.h"
+
+
+/**
+ * @brief Settings shared by every tile a mesher builds
+ */
+typedef struct TerrainMeshSettings {
+
+    ///Quads along each tile edge, a tile has tileQuads + 1 vertices along each edge
+    int tileQuads;
+
+    ///World distance between neighbouring vertices
+    float spacing;
+
+    ///Noise coordinates per world unit
+    float noiseScale;
+
+    ///World height of a noise value of 1
+    float heightScale;
+
+    ///How far the border skirts hang below the surface, zero or less for no skirts
+    float skirtDepth;
+
+} TerrainMeshSettings_t;
+
+
+
+/**
+ * @brief One interleaved vertex, y up, the noise spread over x and z
+ */
+typedef struct TerrainVertex {
+
+    float x;
+    float y;
+    float z;
+    float normalX;
+    float normalY;
+    float normalZ;
+
+} TerrainVertex_t;
+
+
+
+/**
+ * @brief Returns 64 quad tiles of unit spacing, scale and height with skirts 1 unit deep
+ */
+inline TerrainMeshSettings_t DefaultTerrainMeshSettings()
+{
+    TerrainMeshSettings_t settings;
+    settings.tileQuads = 64;
+    settings.spacing = 1.0f;
+    settings.noiseScale = 1.0f;
+    settings.heightScale = 1.0f;
+    settings.skirtDepth = 1.0f;
+    return settings;
+}
+
+
+
+
+/**
+ * @brief Builds terrain tiles straight from a height noise, Fractal or a batch adapter with EvaluateDerivative. \n
+ * Heights and normals come from the analytic noise derivatives a block at a time, so no height map is
+ * stored and no neighbouring samples are needed for finite differences. Every tile has the same
+ * layout, so one index buffer serves all of them.
+ */
+template<typename HeightNoise>
+class TerrainMesher
+{
+
+private:
+
+    ///Vertices handed to the noise at a time
+    static const int BlockSize = 256;
+
+    void BuildIndices();
+
+
+protected:
+
+    ///The noise the heights and normals are sampled from
+    HeightNoise m_udtHeightNoise;
+
+    TerrainMeshSettings_t m_udtSettings;
+
+    ///Triangle list shared by every tile, surface first and then the skirts
+    std::vector<unsigned int> m_vIndices;
+
+
+public:
+
+    TerrainMesher(const HeightNoise& heightNoise, const TerrainMeshSettings_t& settings);
+    ~TerrainMesher();
+
+    void SetSettings(const TerrainMeshSettings_t& settings);
+
+    /**
+    * \brief Returns the settings every tile is built with
+    */
+    const inline TerrainMeshSettings_t& GetSettings() const
+    {
+        return m_udtSettings;
+    }
+
+    /**
+    * \brief Returns the triangle list every tile shares, three indices into the tile vertices per triangle
+    */
+    const inline std::vector<unsigned int>& GetIndices() const
+    {
+        return m_vIndices;
+    }
+
+    size_t GetVerticesPerTile() const;
+
+    void BuildTile(long long tileX, long long tileZ, TerrainVertex_t* vertices) const;
+    void BuildTiles(const long long* tileX, const long long* tileZ, size_t tileCount, TerrainVertex_t* vertices,
+        int threadCount) const;
+
+    template<typename Consumer>
+    void StreamTiles(long long firstTileX, long long firstTileZ, int tilesWide, int tilesDeep, int threadCount,
+        Consumer consumer) const;
+};
+
+
+
+
+#include "gterrainmesh.cpp"
+
+
+#endif // GTERRAINMESH_H_INCLUDED
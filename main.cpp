@@ -21,9 +21,12 @@
 
 #include <cstdio>
 #include <iostream>
+#include <chrono>
+#include <vector>
 
 #include "grng.h"
 #include "grandomAlgorithms.h"
+#include "gsimplex.h"
 
 
 int GetMainInput()
@@ -45,6 +48,7 @@ int GetMainInput()
     std::cout << "5: Noise Values" << std::endl;
     std::cout << "6: Algorithms" << std::endl;
     std::cout << "7: GRNG setup" << std::endl;
+    std::cout << "8: Noise benchmarks" << std::endl;
     std::cout << "-----------------------------------------------------" << std::endl;
 
     while (modeSelection <= 0 || modeSelection >= 8)
@@ -72,6 +76,7 @@ int GetMainInput()
             std::cout << "5: Noise Values" << std::endl;
             std::cout << "6: Algorithms" << std::endl;
             std::cout << "7: GRNG setup" << std::endl;
+            std::cout << "8: Noise benchmarks" << std::endl;
             std::cout << "-----------------------------------------------------" << std::endl;
             std::cout << std::flush << std::endl;
             break;
@@ -92,6 +97,7 @@ int GetMainInput()
             std::cout << "5: Noise Values" << std::endl;
             std::cout << "6: Algorithms" << std::endl;
             std::cout << "7: GRNG setup" << std::endl;
+            std::cout << "8: Noise benchmarks" << std::endl;
             std::cout << "-----------------------------------------------------" << std::endl;
             std::cout << std::flush << std::endl;
             break;
@@ -131,6 +137,9 @@ void ShowAlgorithms();
 template<typename T>
 void GrngSetup(grng<T> &g);
 
+template<typename T>
+void ShowNoiseBenchmarks(grng<T> g);
+
 
 
 int main()
@@ -170,6 +179,9 @@ int main()
         case 7:
             GrngSetup(g);
             break;
+        case 8:
+            ShowNoiseBenchmarks(g);
+            break;
 
         default: break;
         }
@@ -1428,3 +1440,161 @@ void GrngSetup(grng<T>& g)
     }
 }
 
+
+
+/**
+* \brief Times a noise function over a grid of samples and tracks the range of its output
+* \return Nanoseconds per sample
+*/
+template<typename F>
+double BenchmarkNoise(F noiseFunction, int sideLength, float frequency, float& minValue, float& maxValue)
+{
+    float checksum = 0;
+    minValue = 0x7fffffff;
+    maxValue = -0x7fffffff;
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    for (int y = 0; y < sideLength; y++)
+    {
+        for (int x = 0; x < sideLength; x++)
+        {
+            float value = noiseFunction(x * frequency + 0.5f, y * frequency + 0.5f);
+            checksum += value;
+            if (value < minValue) minValue = value;
+            if (value > maxValue) maxValue = value;
+        }
+    }
+
+    std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+    double nanoseconds = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    //Keep the compiler from dropping the loop
+    if (checksum == 12345.678f) std::cout << " ";
+
+    return nanoseconds / ((double)sideLength * sideLength);
+}
+
+
+
+/**
+* \brief Times a noise function that fills an array of samples over the same grid as BenchmarkNoise, a row at a time
+* \return Nanoseconds per sample
+*/
+template<typename F>
+double BenchmarkNoiseBatch(F batchFunction, int sideLength, float frequency, float& minValue, float& maxValue)
+{
+    float checksum = 0;
+    minValue = 0x7fffffff;
+    maxValue = -0x7fffffff;
+    std::vector<float> rowX(sideLength), rowY(sideLength), rowValues(sideLength);
+    for (int x = 0; x < sideLength; x++) rowX[x] = x * frequency + 0.5f;
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    for (int y = 0; y < sideLength; y++)
+    {
+        for (int x = 0; x < sideLength; x++) rowY[x] = y * frequency + 0.5f;
+        batchFunction(&rowX[0], &rowY[0], &rowValues[0], (size_t)sideLength);
+
+        for (int x = 0; x < sideLength; x++)
+        {
+            float value = rowValues[x];
+            checksum += value;
+            if (value < minValue) minValue = value;
+            if (value > maxValue) maxValue = value;
+        }
+    }
+
+    std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+    double nanoseconds = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+
+    //Keep the compiler from dropping the loop
+    if (checksum == 12345.678f) std::cout << " ";
+
+    return nanoseconds / ((double)sideLength * sideLength);
+}
+
+
+
+/**
+* \brief Prints one row of the benchmark table
+*/
+void PrintBenchmarkRow(const char* name, double nanosecondsPerSample, float minValue, float maxValue)
+{
+    std::cout << "\t" << name << ": " << nanosecondsPerSample << " ns/sample, range " << minValue << " to " << maxValue << std::endl;
+}
+
+
+
+template<typename T>
+void ShowNoiseBenchmarks(grng<T> g)
+{
+    int sideLength = 0;
+    float minValue = 0;
+    float maxValue = 0;
+    double nsPerSample = 0;
+    const float frequency = 0.0173f;
+    gsimplex<T> simplex(g.GetSeed());
+
+    std::cout << std::flush << std::endl;
+    system("CLS");
+    std::cout << "\tNOISE BENCHMARKS" << std::endl;
+    std::cout << "-----------------------------------------------------" << std::endl;
+    std::cout << "Every noise is sampled over the same grid and frequency" << std::endl;
+#if defined(__AVX2__)
+    std::cout << "Built with AVX2, rebuild without it for the scalar numbers" << std::endl;
+#else
+    std::cout << "Built without AVX2, rebuild with it (-mavx2 or /arch:AVX2) for the vector numbers" << std::endl;
+#endif
+    std::cout << "-----------------------------------------------------" << std::endl;
+
+    std::cout << "\nEnter grid side length: " << std::flush;
+    if (!(std::cin >> sideLength) || sideLength <= 0) {
+        std::cin.clear(); //clear bad input flag
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); //discard
+        std::cout << "Incorrect entry! " << std::endl;
+        return;
+    }
+
+    std::cout << "\n2D" << std::endl;
+    nsPerSample = BenchmarkNoise([&g](float x, float y) { return g.Perlin2D(x, y); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("Perlin2D (4 corners)", nsPerSample, minValue, maxValue);
+    nsPerSample = BenchmarkNoise([&simplex](float x, float y) { return simplex.Noise2D(x, y); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("Simplex 2D (3 corners)", nsPerSample, minValue, maxValue);
+    nsPerSample = BenchmarkNoise([&g](float x, float y) { return g.HashedPerlin2D(x, y); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("HashedPerlin2D (4 corners, no table)", nsPerSample, minValue, maxValue);
+
+    std::cout << "\n3D" << std::endl;
+    nsPerSample = BenchmarkNoise([&g](float x, float y) { return g.Perlin3D(x, y, 0.37f); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("Perlin3D (8 corners)", nsPerSample, minValue, maxValue);
+    nsPerSample = BenchmarkNoise([&g](float x, float y) { return (float)g.ImprovedNoise(x, y, 0.37); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("ImprovedNoise (8 corners)", nsPerSample, minValue, maxValue);
+    nsPerSample = BenchmarkNoise([&simplex](float x, float y) { return simplex.Noise3D(x, y, 0.37f); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("Simplex 3D (4 corners)", nsPerSample, minValue, maxValue);
+    nsPerSample = BenchmarkNoise([&g](float x, float y) { return g.HashedPerlin3D(x, y, 0.37f); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("HashedPerlin3D (8 corners, no table)", nsPerSample, minValue, maxValue);
+
+    std::cout << "\n4D" << std::endl;
+    nsPerSample = BenchmarkNoise([&simplex](float x, float y) { return simplex.Noise4D(x, y, 0.37f, 0.71f); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("Simplex 4D (5 corners)", nsPerSample, minValue, maxValue);
+
+    std::cout << "\nArrays, table vs hashed gradients" << std::endl;
+    nsPerSample = BenchmarkNoiseBatch([&g](const float* x, const float* y, float* out, size_t count) {
+        g.template PerlinKernel2D<float>(x, y, out, count); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("Perlin2D array (table)", nsPerSample, minValue, maxValue);
+    nsPerSample = BenchmarkNoiseBatch([&g](const float* x, const float* y, float* out, size_t count) {
+        g.HashedPerlin2D(x, y, out, count); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("HashedPerlin2D array (hashed)", nsPerSample, minValue, maxValue);
+    std::vector<float> planeZ(sideLength, 0.37f);
+    nsPerSample = BenchmarkNoiseBatch([&g, &planeZ](const float* x, const float* y, float* out, size_t count) {
+        g.template PerlinKernel3D<float>(x, y, &planeZ[0], out, count); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("Perlin3D array (table)", nsPerSample, minValue, maxValue);
+    nsPerSample = BenchmarkNoiseBatch([&g, &planeZ](const float* x, const float* y, float* out, size_t count) {
+        g.HashedPerlin3D(x, y, &planeZ[0], out, count); }, sideLength, frequency, minValue, maxValue);
+    PrintBenchmarkRow("HashedPerlin3D array (hashed)", nsPerSample, minValue, maxValue);
+
+    std::cout << "\nPress enter to continue" << std::endl;
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    getchar();
+}